@@ -21,11 +21,13 @@
 #include <optional>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "config/b4g_config.h"
 #include "config/pgm_conf.h"
 #include "diagnostic_counter.h"
+#include "memory_stats.h"
 #include "nlohmann/json.hpp"
 #include "utils/path.h"
 #include "utils/path_conversions.h"
@@ -33,6 +35,7 @@
 #include "utils/resource_location.h"
 #include "utils/unicode_text.h"
 #include "workspace_manager.h"
+#include "workspace_manager_response.h"
 
 /*
  * The benchmark is used to evaluate multiple aspects about the performance and accuracy of the parse library.
@@ -49,6 +52,9 @@
  * -m message    - Prepends message before every log entry related to parsed files
  * -g path       - Specifies a path to the folder with .bridge.json
  *
+ * Synthetic workspaces for targeted measurements are in benchmark/workspaces:
+ * - copybook     - One heavy copybook copied into many distinct macros (-p benchmark/workspaces/copybook)
+ *
  * Collected metrics:
  * - File                     - File name
  * - Success                  - Parsing result
@@ -70,8 +76,13 @@
  * - Continued Statements     - Number of statements that were continued (multiple continuations of one statement count
  *as one continued statement)
  * - Non-continued Statements - Number of statements that were not continued
+ * - <Phase> Opcode Cache Hits   - Number of operation code lookups answered by the opcode cache, the phase is one of
+ *                                 Open Code, Macro, Copy and Lookahead
+ * - <Phase> Opcode Cache Misses - Number of operation code lookups that had to search the OPSYN history
  * - Lines                    - Total number of lines
  * - Files                    - Total number of parsed files
+ * - Memory (B)               - Estimated memory retained by the language server after the parsing, broken down per
+ *                              component, workspace and file
  */
 
 using namespace hlasm_plugin;
@@ -115,6 +126,42 @@ struct parsing_metadata_collector final : public parser_library::parsing_metadat
     std::vector<parser_library::parsing_metadata> data;
 };
 
+json collect_memory_stats(parser_library::workspace_manager& ws)
+{
+    struct stats_collector
+    {
+        parser_library::memory_stats stats;
+
+        void provide(const parser_library::memory_stats& s) { stats = s; }
+        void error(int, const char*) noexcept {}
+    };
+    auto [resp, collector] = parser_library::make_workspace_manager_response(std::in_place_type<stats_collector>);
+    ws.memory_stats(resp);
+    const auto& stats = collector->stats;
+
+    json workspaces = json::array();
+    for (const auto& w : stats.workspaces)
+        workspaces.push_back({ { "Workspace", w.uri }, { "Library Indexes", w.library_indexes } });
+
+    json files = json::array();
+    for (const auto& f : stats.files)
+        files.push_back({
+            { "File", f.uri },
+            { "LSP Context", f.lsp_context },
+            { "Semantic Tokens", f.semantic_tokens },
+            { "Hit Counts", f.hit_counts },
+            { "Diagnostics", f.diagnostics },
+        });
+
+    return json({
+        { "Id Storage", stats.id_storage },
+        { "Macro Caches", stats.macro_caches },
+        { "File Texts", stats.file_texts },
+        { "Workspaces", std::move(workspaces) },
+        { "Files", std::move(files) },
+    });
+}
+
 class bench_configuration
 {
 public:
@@ -455,6 +502,8 @@ private:
             reparse_time = time;
         }
 
+        json_res["Memory (B)"] = collect_memory_stats(*parse_params.ws);
+
         auto exec_statements = first_parse_metrics.open_code_statements + first_parse_metrics.copy_statements
             + first_parse_metrics.macro_statements + first_parse_metrics.lookahead_statements
             + first_parse_metrics.reparsed_statements;
@@ -474,6 +523,14 @@ private:
             log_i("Reparsed Statements: ", first_parse_metrics.reparsed_statements);
             log_i("Continued Statements: ", first_parse_metrics.continued_statements);
             log_i("Non-continued Statements: ", first_parse_metrics.non_continued_statements);
+            log_i("Open Code Opcode Cache Hits: ", first_parse_metrics.open_code_opcode_cache_hits);
+            log_i("Open Code Opcode Cache Misses: ", first_parse_metrics.open_code_opcode_cache_misses);
+            log_i("Macro Opcode Cache Hits: ", first_parse_metrics.macro_opcode_cache_hits);
+            log_i("Macro Opcode Cache Misses: ", first_parse_metrics.macro_opcode_cache_misses);
+            log_i("Copy Opcode Cache Hits: ", first_parse_metrics.copy_opcode_cache_hits);
+            log_i("Copy Opcode Cache Misses: ", first_parse_metrics.copy_opcode_cache_misses);
+            log_i("Lookahead Opcode Cache Hits: ", first_parse_metrics.lookahead_opcode_cache_hits);
+            log_i("Lookahead Opcode Cache Misses: ", first_parse_metrics.lookahead_opcode_cache_misses);
             log_i("Lines: ", first_parse_metrics.lines);
             log_i("Executed Statement/ms: ", (double)exec_statements / (double)parse_time);
             log_i("Line/ms: ", (double)first_parse_metrics.lines / (double)parse_time);
@@ -548,6 +605,14 @@ private:
                 { "Reparsed Statements", metrics.reparsed_statements },
                 { "Continued Statements", metrics.continued_statements },
                 { "Non-continued Statements", metrics.non_continued_statements },
+                { "Open Code Opcode Cache Hits", metrics.open_code_opcode_cache_hits },
+                { "Open Code Opcode Cache Misses", metrics.open_code_opcode_cache_misses },
+                { "Macro Opcode Cache Hits", metrics.macro_opcode_cache_hits },
+                { "Macro Opcode Cache Misses", metrics.macro_opcode_cache_misses },
+                { "Copy Opcode Cache Hits", metrics.copy_opcode_cache_hits },
+                { "Copy Opcode Cache Misses", metrics.copy_opcode_cache_misses },
+                { "Lookahead Opcode Cache Hits", metrics.lookahead_opcode_cache_hits },
+                { "Lookahead Opcode Cache Misses", metrics.lookahead_opcode_cache_misses },
                 { "Lines", metrics.lines },
                 { "Files", files_processed },
             }),
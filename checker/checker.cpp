@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "checker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <regex>
+#include <thread>
+#include <utility>
+
+#include "config/pgm_conf.h"
+#include "diagnostic.h"
+#include "lib_config.h"
+#include "protocol.h"
+#include "utils/error_codes.h"
+#include "utils/path.h"
+#include "utils/path_conversions.h"
+#include "utils/platform.h"
+#include "utils/unicode_text.h"
+#include "workspace_manager.h"
+#include "workspace_manager_requests.h"
+#include "workspaces/wildcard.h"
+
+namespace hlasm_plugin::checker {
+
+using json = nlohmann::json;
+
+namespace {
+template<typename... Args>
+void log_e(Args... args)
+{
+    ((std::clog << "Error: ") << ... << args) << std::endl;
+}
+
+std::string content_hash(std::string_view text)
+{
+    // FNV-1a, the result must be stable across runs
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (unsigned char c : text)
+    {
+        hash ^= c;
+        hash *= 0x100000001b3;
+    }
+
+    constexpr std::string_view digits = "0123456789abcdef";
+    std::string result(16, '0');
+    for (auto it = result.rbegin(); it != result.rend(); ++it, hash >>= 4)
+        *it = digits[hash & 15];
+
+    return result;
+}
+
+std::string file_content_hash(const std::string& path)
+{
+    auto content = utils::platform::read_file(path);
+    if (!content.has_value())
+        return {};
+    return content_hash(*content);
+}
+
+// Member lookups only depend on the names of the files in the library
+std::string library_listing_hash(const std::string& uri)
+{
+    std::vector<std::string> files;
+    const auto rc = utils::path::list_directory_regular_files(utils::path::uri_to_path(uri),
+        [&files](const auto& p) { files.emplace_back(utils::path::filename(p).string()); });
+    if (rc != utils::path::list_directory_rc::done)
+        return {};
+
+    std::ranges::sort(files);
+
+    std::string listing;
+    for (const auto& f : files)
+        listing.append(f).append(1, '\n');
+
+    return content_hash(listing);
+}
+
+json diagnostic_to_json(const parser_library::diagnostic& d)
+{
+    return json {
+        { "uri", d.file_uri },
+        { "code", d.code },
+        { "severity", static_cast<int>(d.severity) },
+        { "message", d.message },
+        { "range",
+            { d.diag_range.start.line, d.diag_range.start.column, d.diag_range.end.line, d.diag_range.end.column } },
+    };
+}
+} // namespace
+
+check_configuration::check_configuration()
+    : ws_folder(utils::path::current_path().string())
+    , workers(std::max(1u, std::thread::hardware_concurrency()))
+{}
+
+bool check_configuration::load(int argc, char** argv)
+{
+    std::vector<std::string> patterns;
+    if (!load_options(argc, argv, patterns))
+        return false;
+
+    if (patterns.empty())
+        return load_configured_programs();
+
+    for (const auto& p : patterns)
+        expand_pattern(p);
+
+    return true;
+}
+
+std::string check_configuration::configuration_hash() const
+{
+    std::string result;
+    for (const auto* cfg : { "/.hlasmplugin/proc_grps.json", "/.hlasmplugin/pgm_conf.json" })
+        result.append(file_content_hash(ws_folder + cfg)).append(1, ':');
+    result.append(content_hash(settings.value_or("")));
+    return result;
+}
+
+bool check_configuration::load_options(int argc, char** argv, std::vector<std::string>& patterns)
+{
+    const auto advance_and_retrieve = [argc, &argv](std::string_view option, auto& i, auto& s) {
+        if (i + 1 >= argc)
+        {
+            log_e("Missing parameter for option ", option);
+            return false;
+        }
+
+        s = static_cast<std::string>(argv[++i]);
+        return true;
+    };
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string val;
+        if (std::string arg = argv[i]; arg == "-p") // Path parameter, path to the folder containing .hlasmplugin
+        {
+            if (!advance_and_retrieve(arg, i, ws_folder))
+                return false;
+            ws_folder = utils::path::absolute(ws_folder).string();
+        }
+        else if (arg == "-j") // Number of workers
+        {
+            if (!advance_and_retrieve(arg, i, val))
+                return false;
+            try
+            {
+                workers = static_cast<unsigned>(std::max(1ul, std::stoul(val)));
+            }
+            catch (...)
+            {
+                log_e("Number of workers must be an integer");
+                return false;
+            }
+        }
+        else if (arg == "-f") // Output format
+        {
+            if (!advance_and_retrieve(arg, i, val))
+                return false;
+            if (val == "json")
+                format = output_format::json;
+            else if (val == "sarif")
+                format = output_format::sarif;
+            else
+            {
+                log_e("Unknown output format ", val);
+                return false;
+            }
+        }
+        else if (arg == "-o") // Output file
+        {
+            if (!advance_and_retrieve(arg, i, output_file))
+                return false;
+        }
+        else if (arg == "-s") // Settings file
+        {
+            if (!advance_and_retrieve(arg, i, val))
+                return false;
+            settings = utils::platform::read_file(val);
+            if (!settings.has_value() || !json::accept(*settings))
+            {
+                log_e("Invalid settings file ", val);
+                return false;
+            }
+        }
+        else if (arg == "-i") // Incremental state file
+        {
+            if (!advance_and_retrieve(arg, i, state_file))
+                return false;
+        }
+        else if (arg.starts_with("-"))
+        {
+            log_e("Unknown parameter ", arg);
+            return false;
+        }
+        else
+            patterns.emplace_back(std::move(arg));
+    }
+
+    return true;
+}
+
+bool check_configuration::load_configured_programs()
+{
+    auto cfg = utils::platform::read_file(ws_folder + "/.hlasmplugin/pgm_conf.json");
+    if (!cfg.has_value())
+    {
+        log_e("Non-existing configuration file: .hlasmplugin/pgm_conf.json");
+        return false;
+    }
+
+    try
+    {
+        parser_library::config::pgm_conf pgm_conf;
+        json::parse(cfg.value(), nullptr, true, true).get_to(pgm_conf);
+        for (const auto& pgm : pgm_conf.pgms)
+        {
+            if (pgm.program.find_first_of("*?") == std::string::npos)
+                programs.emplace_back(pgm.program);
+        }
+    }
+    catch (...)
+    {
+        log_e("Invalid configuration file: .hlasmplugin/pgm_conf.json");
+        return false;
+    }
+
+    return true;
+}
+
+void check_configuration::expand_pattern(const std::string& pattern)
+{
+    const auto name = utils::path::filename(pattern).string();
+    if (name.find_first_of("*?") == std::string::npos)
+    {
+        programs.emplace_back(pattern);
+        return;
+    }
+
+    const auto dir = utils::path::parent_path(pattern);
+    const auto matcher = parser_library::workspaces::wildcard2regex(name);
+
+    std::vector<std::string> matched;
+    utils::path::list_directory_regular_files(utils::path::join(ws_folder, dir), [&](const auto& p) {
+        if (auto file = utils::path::filename(p).string(); std::regex_match(file, matcher))
+            matched.emplace_back(utils::path::join(dir, file).string());
+    });
+    std::ranges::sort(matched);
+    programs.insert(programs.end(), matched.begin(), matched.end());
+}
+
+class checker::diagnostic_collector final : public parser_library::diagnostics_consumer
+{
+public:
+    void consume_diagnostics(
+        std::span<const parser_library::diagnostic> diagnostics, std::span<const parser_library::fade_message>) override
+    {
+        last.assign(diagnostics.begin(), diagnostics.end());
+    }
+
+    std::vector<parser_library::diagnostic> last;
+};
+
+class checker::metadata_collector final : public parser_library::parsing_metadata_consumer
+{
+public:
+    void consume_parsing_metadata(std::string_view, double, const parser_library::parsing_metadata& metadata) override
+    {
+        info = metadata.ws_info;
+    }
+
+    void outputs_changed(std::string_view) override {}
+
+    parser_library::workspace_file_info info;
+};
+
+// Provides the settings an editor would send
+class checker::settings_provider final : public parser_library::workspace_manager_requests
+{
+    const std::string& m_settings;
+
+public:
+    explicit settings_provider(const std::string& settings)
+        : m_settings(settings)
+    {}
+
+    void request_workspace_configuration(
+        std::string_view, parser_library::workspace_manager_response<std::string_view> json_text) override
+    {
+        json_text.provide(m_settings);
+    }
+
+    void request_file_configuration(
+        std::string_view, parser_library::workspace_manager_response<std::string_view> json_text) override
+    {
+        json_text.error(utils::error::not_found);
+    }
+};
+
+checker::checker(const check_configuration& config)
+    : m_config(config)
+    , m_results(config.programs.size())
+    , m_configuration_hash(config.configuration_hash())
+{
+    if (!m_config.state_file)
+        return;
+
+    if (auto state = utils::platform::read_file(*m_config.state_file); state.has_value())
+    {
+        try
+        {
+            m_previous_state = json::parse(*state);
+            if (m_previous_state.value("configuration", "") != m_configuration_hash)
+                m_previous_state = json();
+        }
+        catch (...)
+        {
+            m_previous_state = json();
+        }
+    }
+}
+
+void checker::run()
+{
+    std::atomic<size_t> next = 0;
+    const auto work = [this, &next]() {
+        std::unique_ptr<parser_library::workspace_manager> ws;
+        std::optional<settings_provider> settings;
+        diagnostic_collector diags;
+        metadata_collector metadata;
+
+        while (true)
+        {
+            const size_t i = next++;
+            if (i >= m_config.programs.size())
+                break;
+
+            auto content = utils::platform::read_file(program_path(i));
+            if (!content.has_value())
+            {
+                log_e("File read error: ", m_config.programs[i]);
+                continue;
+            }
+
+            auto& result = m_results[i];
+            result.hash = content_hash(*content);
+            const auto bridge = utils::path::join(utils::path::parent_path(program_path(i)), ".bridge.json");
+            result.bridge_hash = file_content_hash(bridge.string());
+            if (reuse_previous(i))
+                continue;
+
+            if (!ws)
+            {
+                ws = parser_library::create_workspace_manager({ .report_dependencies = true });
+                ws->register_diagnostics_consumer(&diags);
+                ws->register_parsing_metadata_consumer(&metadata);
+                if (m_config.settings)
+                {
+                    ws->set_request_interface(&settings.emplace(*m_config.settings));
+
+                    parser_library::lib_config cfg;
+                    const auto hlasm = json::parse(*m_config.settings).value("hlasm", json::object());
+                    if (const auto limit = hlasm.find("diagnosticsSuppressLimit");
+                        limit != hlasm.end() && limit->is_number())
+                        cfg.diag_supress_limit = std::max<std::int64_t>(limit->get<std::int64_t>(), 0);
+                    ws->configuration_changed(cfg, *m_config.settings);
+                }
+                ws->add_workspace(m_config.ws_folder, utils::path::path_to_uri(m_config.ws_folder));
+                ws->idle_handler();
+            }
+
+            analyze(*ws, i, utils::replace_non_utf8_chars(*content), diags, metadata);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < m_config.workers && i < m_config.programs.size(); ++i)
+        workers.emplace_back(work);
+    work();
+    for (auto& w : workers)
+        w.join();
+}
+
+bool checker::write_output(std::ostream& out) const
+{
+    bool clean = true;
+    for (const auto& r : m_results)
+    {
+        clean &= r.success;
+        for (const auto& d : r.diagnostics)
+            clean &= d["severity"] != static_cast<int>(parser_library::diagnostic_severity::error);
+    }
+
+    out << (m_config.format == output_format::sarif ? sarif_output() : json_output()).dump(2) << '\n';
+
+    return clean;
+}
+
+void checker::write_state() const
+{
+    if (!m_config.state_file)
+        return;
+
+    json programs = json::object();
+    for (size_t i = 0; i < m_results.size(); ++i)
+    {
+        if (const auto& r = m_results[i]; r.success)
+            programs[m_config.programs[i]] = {
+                { "hash", r.hash },
+                { "bridge", r.bridge_hash },
+                { "dependencies", r.dependencies },
+                { "lookups", r.lookups },
+                { "libraries", r.libraries },
+                { "diagnostics", r.diagnostics },
+            };
+    }
+
+    std::ofstream state(*m_config.state_file);
+    state << json { { "configuration", m_configuration_hash }, { "programs", programs } };
+}
+
+std::string checker::program_path(size_t i) const
+{
+    return utils::path::absolute(utils::path::join(m_config.ws_folder, m_config.programs[i])).string();
+}
+
+// called concurrently, the previous state must not be modified
+bool checker::reuse_previous(size_t i)
+{
+    const auto& state = std::as_const(m_previous_state);
+    if (!state.is_object() || !state.contains("programs"))
+        return false;
+
+    const auto& programs = state.at("programs");
+    const auto it = programs.find(m_config.programs[i]);
+    if (it == programs.end())
+        return false;
+
+    auto& result = m_results[i];
+    if (it->value("hash", "") != result.hash || it->value("bridge", "") != result.bridge_hash)
+        return false;
+
+    try
+    {
+        // unchanged member lists of the libraries resolve every lookup, including the failed ones, the same way
+        for (const auto& [uri, hash] : it->at("libraries").items())
+        {
+            if (library_listing_hash(uri) != hash.get<std::string>())
+                return false;
+        }
+        for (const auto& [uri, hash] : it->at("dependencies").items())
+        {
+            if (file_content_hash(utils::path::uri_to_path(uri)) != hash.get<std::string>())
+                return false;
+        }
+
+        result.dependencies = it->at("dependencies");
+        result.lookups = it->at("lookups");
+        result.libraries = it->at("libraries");
+        result.diagnostics = it->at("diagnostics");
+    }
+    catch (...)
+    {
+        return false;
+    }
+
+    result.success = true;
+    result.cached = true;
+
+    return true;
+}
+
+void checker::analyze(parser_library::workspace_manager& ws,
+    size_t i,
+    const std::string& content,
+    diagnostic_collector& diags,
+    metadata_collector& metadata)
+{
+    auto& result = m_results[i];
+    const auto uri = utils::path::path_to_uri(program_path(i));
+
+    metadata.info = {};
+    try
+    {
+        ws.did_open_file(uri, 1, content);
+        ws.idle_handler();
+
+        for (const auto& d : diags.last)
+            result.diagnostics.push_back(diagnostic_to_json(d));
+        for (const auto& dep : metadata.info.dependencies)
+            result.dependencies[dep] = file_content_hash(utils::path::uri_to_path(dep));
+        for (const auto& [name, member_uri] : metadata.info.library_lookups)
+            result.lookups[name] = member_uri;
+        for (const auto& lib : metadata.info.libraries)
+            result.libraries[lib] = library_listing_hash(lib);
+        result.success = true;
+
+        ws.did_close_file(uri);
+        ws.idle_handler();
+    }
+    catch (const std::exception& e)
+    {
+        log_e(m_config.programs[i], ": ", e.what());
+    }
+    catch (...)
+    {
+        log_e(m_config.programs[i], ": analysis failed");
+    }
+}
+
+json checker::json_output() const
+{
+    json programs = json::array();
+    size_t errors = 0;
+    size_t warnings = 0;
+    size_t cached = 0;
+
+    for (size_t i = 0; i < m_results.size(); ++i)
+    {
+        const auto& r = m_results[i];
+        for (const auto& d : r.diagnostics)
+        {
+            errors += d["severity"] == static_cast<int>(parser_library::diagnostic_severity::error);
+            warnings += d["severity"] == static_cast<int>(parser_library::diagnostic_severity::warning);
+        }
+        cached += r.cached;
+
+        programs.push_back({
+            { "program", m_config.programs[i] },
+            { "success", r.success },
+            { "cached", r.cached },
+            { "diagnostics", r.diagnostics },
+        });
+    }
+
+    return json {
+        { "programs", programs },
+        { "total",
+            {
+                { "programs", m_results.size() },
+                { "cached", cached },
+                { "errors", errors },
+                { "warnings", warnings },
+            } },
+    };
+}
+
+json checker::sarif_output() const
+{
+    constexpr auto level = [](int severity) {
+        switch (static_cast<parser_library::diagnostic_severity>(severity))
+        {
+            case parser_library::diagnostic_severity::error:
+                return "error";
+            case parser_library::diagnostic_severity::warning:
+                return "warning";
+            default:
+                return "note";
+        }
+    };
+
+    json results = json::array();
+    for (const auto& r : m_results)
+    {
+        for (const auto& d : r.diagnostics)
+        {
+            const auto& range = d["range"];
+            results.push_back({
+                { "ruleId", d["code"] },
+                { "level", level(d["severity"].get<int>()) },
+                { "message", { { "text", d["message"] } } },
+                { "locations",
+                    json::array({
+                        { { "physicalLocation",
+                            { { "artifactLocation", { { "uri", d["uri"] } } },
+                                { "region",
+                                    {
+                                        { "startLine", range[0].get<size_t>() + 1 },
+                                        { "startColumn", range[1].get<size_t>() + 1 },
+                                        { "endLine", range[2].get<size_t>() + 1 },
+                                        { "endColumn", range[3].get<size_t>() + 1 },
+                                    } } } } },
+                    }) },
+            });
+        }
+    }
+
+    return json {
+        { "$schema", "https://json.schemastore.org/sarif-2.1.0.json" },
+        { "version", "2.1.0" },
+        { "runs",
+            json::array({
+                {
+                    { "tool", { { "driver", { { "name", "hlasm_check" } } } } },
+                    { "results", results },
+                },
+            }) },
+    };
+}
+
+} // namespace hlasm_plugin::checker
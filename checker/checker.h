@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_CHECKER_CHECKER_H
+#define HLASMPLUGIN_CHECKER_CHECKER_H
+
+#include <optional>
+#include <ostream>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+/*
+ * The checker analyzes programs of a standard HLASM workspace folder without an editor and reports their diagnostics.
+ * Programs are distributed among several workers, each of them owning its own workspace manager.
+ *
+ * Usage: hlasm_check [options] [program...]
+ *
+ * Programs are paths relative to the workspace folder, wildcards are supported in the file name part.
+ * When no program is specified, all programs defined in the workspace's pgm_conf.json are analyzed.
+ *
+ * Accepted parameters:
+ * -p path       - Specifies a path to the folder with .hlasmplugin, current directory by default
+ * -j count      - Number of workers, number of hardware threads by default
+ * -f format     - Output format, either json (default) or sarif
+ * -o file       - Writes the output to a file instead of the standard output
+ * -s file       - Settings of the workspace, the JSON object an editor would provide (e.g. {"hlasm":{...}})
+ * -i file       - Incremental state; programs whose source, library members and lookups, libraries and configuration
+ *                 did not change since the state was written are not analyzed again and their previous diagnostics
+ *                 are reported
+ *
+ * Exit codes:
+ * 0 - No errors were found
+ * 1 - Errors were reported or some program could not be analyzed
+ * 2 - Invalid parameters
+ */
+
+namespace hlasm_plugin::parser_library {
+class workspace_manager;
+} // namespace hlasm_plugin::parser_library
+
+namespace hlasm_plugin::checker {
+
+enum class output_format
+{
+    json,
+    sarif,
+};
+
+class check_configuration
+{
+public:
+    std::string ws_folder;
+    unsigned workers;
+    output_format format = output_format::json;
+    std::optional<std::string> output_file;
+    std::optional<std::string> state_file;
+    std::optional<std::string> settings;
+    std::vector<std::string> programs;
+
+    check_configuration();
+
+    bool load(int argc, char** argv);
+
+    // Identifies the workspace-wide configuration inputs: configuration files and settings
+    std::string configuration_hash() const;
+
+private:
+    bool load_options(int argc, char** argv, std::vector<std::string>& patterns);
+    bool load_configured_programs();
+    void expand_pattern(const std::string& pattern);
+};
+
+struct program_result
+{
+    bool success = false;
+    bool cached = false;
+    std::string hash;
+    // content hash of the B4G configuration next to the program
+    std::string bridge_hash;
+    // content hashes of the library members read by the analysis
+    nlohmann::json dependencies = nlohmann::json::object();
+    // every member lookup with its resolved uri, empty when the member was not found
+    nlohmann::json lookups = nlohmann::json::object();
+    // hashes of the member lists of the libraries, guard the lookups against new and removed members
+    nlohmann::json libraries = nlohmann::json::object();
+    nlohmann::json diagnostics = nlohmann::json::array();
+};
+
+class checker
+{
+    const check_configuration& m_config;
+    std::vector<program_result> m_results;
+    nlohmann::json m_previous_state;
+    std::string m_configuration_hash;
+
+public:
+    explicit checker(const check_configuration& config);
+
+    void run();
+
+    // Returns true when no errors were found
+    bool write_output(std::ostream& out) const;
+
+    void write_state() const;
+
+    std::span<const program_result> results() const { return m_results; }
+
+private:
+    class diagnostic_collector;
+    class metadata_collector;
+    class settings_provider;
+
+    std::string program_path(size_t i) const;
+    bool reuse_previous(size_t i);
+    void analyze(parser_library::workspace_manager& ws,
+        size_t i,
+        const std::string& content,
+        diagnostic_collector& diags,
+        metadata_collector& metadata);
+
+    nlohmann::json json_output() const;
+    nlohmann::json sarif_output() const;
+};
+
+} // namespace hlasm_plugin::checker
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <fstream>
+#include <iostream>
+
+#include "checker.h"
+
+using namespace hlasm_plugin::checker;
+
+int main(int argc, char** argv)
+{
+    check_configuration config;
+    if (!config.load(argc, argv))
+        return 2;
+
+    checker c(config);
+    c.run();
+
+    bool clean;
+    if (config.output_file)
+    {
+        std::ofstream out(*config.output_file);
+        clean = c.write_output(out);
+    }
+    else
+        clean = c.write_output(std::cout);
+
+    c.write_state();
+
+    return clean ? 0 : 1;
+}
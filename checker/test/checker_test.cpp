@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "checker.h"
+
+using namespace hlasm_plugin::checker;
+
+namespace {
+std::atomic<int> workspace_counter = 0;
+} // namespace
+
+class checker_test : public testing::Test
+{
+protected:
+    std::filesystem::path m_dir = std::filesystem::temp_directory_path()
+        / ("hlasm_checker_test_" + std::to_string(testing::UnitTest::GetInstance()->random_seed()) + "_"
+            + std::to_string(++workspace_counter));
+
+    void SetUp() override
+    {
+        std::filesystem::remove_all(m_dir);
+        write(".hlasmplugin/proc_grps.json",
+            R"({"pgroups":[{"name":"P1","libs":["libs1","libs2"],"preprocessor":"ENDEVOR"}]})");
+        write(".hlasmplugin/pgm_conf.json", R"({"pgms":[{"program":"PGM","pgroup":"P1"}]})");
+        std::filesystem::create_directories(m_dir / "libs1");
+        write("libs2/MAC", " MACRO\n MAC\n MNOTE 4,'MAC 1'\n MEND\n");
+        write("libs2/INCL", " MNOTE 4,'INCL 1'\n");
+        write("PGM", " MAC\n MISSING\n-INC INCL\n");
+    }
+
+    void TearDown() override { std::filesystem::remove_all(m_dir); }
+
+    void write(const std::string& name, std::string_view content) const
+    {
+        const auto file = m_dir / name;
+        std::filesystem::create_directories(file.parent_path());
+        std::ofstream(file, std::ios::binary | std::ios::trunc) << content;
+    }
+
+    std::vector<program_result> check(std::optional<std::string> settings = std::nullopt) const
+    {
+        check_configuration config;
+        config.ws_folder = m_dir.string();
+        config.workers = 1;
+        config.state_file = (m_dir / "state.json").string();
+        config.settings = std::move(settings);
+        config.programs = { "PGM" };
+
+        checker c(config);
+        c.run();
+        c.write_state();
+
+        return { c.results().begin(), c.results().end() };
+    }
+
+    static std::vector<std::string> messages(const program_result& r)
+    {
+        std::vector<std::string> result;
+        for (const auto& d : r.diagnostics)
+            result.push_back(d["message"].get<std::string>());
+        std::ranges::sort(result);
+        return result;
+    }
+
+    void expect_reanalyzed() const
+    {
+        const auto first = check();
+        ASSERT_EQ(first.size(), 1);
+        ASSERT_TRUE(first[0].success);
+        EXPECT_FALSE(first[0].cached);
+    }
+};
+
+TEST_F(checker_test, unchanged_program_reused)
+{
+    const auto first = check();
+    ASSERT_EQ(first.size(), 1);
+    EXPECT_TRUE(first[0].success);
+    EXPECT_FALSE(first[0].cached);
+    EXPECT_EQ(messages(first[0]),
+        (std::vector<std::string> { "INCL 1", "MAC 1", "Operation code not found - MISSING" }));
+
+    const auto second = check();
+    ASSERT_EQ(second.size(), 1);
+    EXPECT_TRUE(second[0].success);
+    EXPECT_TRUE(second[0].cached);
+    EXPECT_EQ(second[0].diagnostics, first[0].diagnostics);
+}
+
+TEST_F(checker_test, lookups_recorded)
+{
+    const auto result = check();
+    ASSERT_EQ(result.size(), 1);
+
+    const auto& lookups = result[0].lookups;
+    ASSERT_TRUE(lookups.contains("MAC"));
+    ASSERT_TRUE(lookups.contains("INCL"));
+    ASSERT_TRUE(lookups.contains("MISSING"));
+    EXPECT_EQ(lookups["MISSING"], "");
+    EXPECT_TRUE(result[0].dependencies.contains(lookups["MAC"].get<std::string>()));
+    EXPECT_TRUE(result[0].dependencies.contains(lookups["INCL"].get<std::string>()));
+    EXPECT_EQ(result[0].libraries.size(), 2);
+}
+
+TEST_F(checker_test, changed_macro)
+{
+    check();
+    write("libs2/MAC", " MACRO\n MAC\n MNOTE 4,'MAC 2'\n MEND\n");
+
+    const auto result = check();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_FALSE(result[0].cached);
+    EXPECT_EQ(messages(result[0]),
+        (std::vector<std::string> { "INCL 1", "MAC 2", "Operation code not found - MISSING" }));
+}
+
+TEST_F(checker_test, changed_preprocessor_include)
+{
+    check();
+    write("libs2/INCL", " MNOTE 4,'INCL 2'\n");
+
+    const auto result = check();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_FALSE(result[0].cached);
+    EXPECT_EQ(messages(result[0]),
+        (std::vector<std::string> { "INCL 2", "MAC 1", "Operation code not found - MISSING" }));
+}
+
+TEST_F(checker_test, missing_member_added)
+{
+    check();
+    write("libs2/MISSING", " MACRO\n MISSING\n MEND\n");
+
+    const auto result = check();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_FALSE(result[0].cached);
+    EXPECT_EQ(messages(result[0]), (std::vector<std::string> { "INCL 1", "MAC 1" }));
+}
+
+TEST_F(checker_test, member_shadowed)
+{
+    check();
+    write("libs1/MAC", " MACRO\n MAC\n MNOTE 4,'SHADOW'\n MEND\n");
+
+    const auto result = check();
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_FALSE(result[0].cached);
+    EXPECT_EQ(
+        messages(result[0]), (std::vector<std::string> { "INCL 1", "Operation code not found - MISSING", "SHADOW" }));
+}
+
+TEST_F(checker_test, bridge_configuration_changed)
+{
+    check();
+    write(".bridge.json", R"({"elements":{},"defaultProcessorGroup":"P1"})");
+
+    expect_reanalyzed();
+}
+
+TEST_F(checker_test, settings_changed)
+{
+    check();
+
+    const auto result = check(R"({"hlasm":{"diagnosticsSuppressLimit":5}})");
+    ASSERT_EQ(result.size(), 1);
+    EXPECT_FALSE(result[0].cached);
+}
+
+TEST_F(checker_test, configuration_changed)
+{
+    check();
+    write(".hlasmplugin/proc_grps.json", R"({"pgroups":[{"name":"P1","libs":["libs2"],"preprocessor":"ENDEVOR"}]})");
+
+    expect_reanalyzed();
+}
@@ -48,6 +48,13 @@ interface ExternalReadFileResponse {
     data: string,
 }
 
+const readFilesRequest = 'read_files';
+
+interface ExternalReadFilesResponse {
+    id: number,
+    data: ({ data: string } | { error: ExternalErrorResponse['error'] })[],
+}
+
 interface ExternalListDirectoryResponse {
     id: number,
     data: {
@@ -651,10 +658,29 @@ export class HLASMExternalFiles {
         });
     }
 
-    public async handleRawMessage(msg: any): Promise<ExternalReadFileResponse | ExternalListDirectoryResponse | ExternalErrorResponse | null> {
+    private async handleReadFilesMessage(msg: { id: number, urls: string[] }): Promise<ExternalReadFilesResponse> {
+        const results = await Promise.all(msg.urls.map(url => this.handleRawMessage({ id: msg.id, op: ExternalRequestType.read_file, url })));
+
+        return {
+            id: msg.id,
+            data: results.map(x => {
+                if (!x) return { error: { code: -1000, msg: 'No response' } };
+                if ('error' in x) return { error: x.error };
+                return { data: <string>x.data };
+            }),
+        };
+    }
+
+    public async handleRawMessage(msg: any): Promise<ExternalReadFileResponse | ExternalReadFilesResponse | ExternalListDirectoryResponse | ExternalErrorResponse | null> {
         if (!msg || typeof msg.id !== 'number' || typeof msg.op !== 'string')
             return null;
 
+        if (msg.op === readFilesRequest) {
+            if (!Array.isArray(msg.urls) || !msg.urls.every((x: any) => typeof x === 'string'))
+                return this.generateError(msg.id, -5, 'Invalid request');
+            return this.handleReadFilesMessage(msg);
+        }
+
         if (typeof msg.url !== 'string')
             return this.generateError(msg.id, -5, 'Invalid request');
 
@@ -46,6 +46,15 @@ suite('External files', () => {
 
         assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_file', url: 'test:/SERVICE' }), { id: 5, error: { code: -1000, msg: 'No client' } });
 
+        assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_files', url: 'unknown:scheme' }), { id: 5, error: { code: -5, msg: 'Invalid request' } });
+        assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_files', urls: [5] }), { id: 5, error: { code: -5, msg: 'Invalid request' } });
+        assert.deepStrictEqual(await ext.handleRawMessage({ id: 5, op: 'read_files', urls: ['unknown:scheme', 'test:/SERVICE'] }), {
+            id: 5, data: [
+                { error: { code: -1000, msg: 'not found' } },
+                { error: { code: -1000, msg: 'No client' } },
+            ]
+        });
+
         attached.dispose();
     });
 
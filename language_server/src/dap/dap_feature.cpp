@@ -103,6 +103,8 @@ void dap_feature::register_methods(std::map<std::string, method>& methods)
     add_method("next", &dap_feature::on_next, LOG_EVENT);
     add_method("stepIn", &dap_feature::on_step_in, LOG_EVENT);
     add_method("stepOut", &dap_feature::on_step_out, LOG_EVENT);
+    add_method("stepBack", &dap_feature::on_step_back, LOG_EVENT);
+    add_method("reverseContinue", &dap_feature::on_reverse_continue, LOG_EVENT);
     add_method("variables", &dap_feature::on_variables);
     add_method("continue", &dap_feature::on_continue, LOG_EVENT);
     add_method("pause", &dap_feature::on_pause, LOG_EVENT);
@@ -160,6 +162,7 @@ void dap_feature::on_initialize(const request_id& requested_seq, const nlohmann:
             { "supportsConfigurationDoneRequest", true },
             { "supportsEvaluateForHovers", true },
             { "supportsFunctionBreakpoints", true },
+            { "supportsStepBack", true },
         });
 
     line_1_based_ = args.at("linesStartAt1").get<bool>() ? 1 : 0;
@@ -386,6 +389,24 @@ void dap_feature::on_step_out(const request_id& request_seq, const nlohmann::jso
     response_->respond(request_seq, "stepOut", nlohmann::json());
 }
 
+void dap_feature::on_step_back(const request_id& request_seq, const nlohmann::json&)
+{
+    if (!debugger)
+        return;
+
+    debugger->step_back();
+    response_->respond(request_seq, "stepBack", nlohmann::json());
+}
+
+void dap_feature::on_reverse_continue(const request_id& request_seq, const nlohmann::json&)
+{
+    if (!debugger)
+        return;
+
+    debugger->reverse_continue();
+    response_->respond(request_seq, "reverseContinue", nlohmann::json());
+}
+
 void dap_feature::on_variables(const request_id& request_seq, const nlohmann::json& args)
 {
     if (!debugger)
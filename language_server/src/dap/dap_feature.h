@@ -67,6 +67,8 @@ public:
     void on_next(const request_id& request_seq, const nlohmann::json& args);
     void on_step_in(const request_id& request_seq, const nlohmann::json& args);
     void on_step_out(const request_id& request_seq, const nlohmann::json& args);
+    void on_step_back(const request_id& request_seq, const nlohmann::json& args);
+    void on_reverse_continue(const request_id& request_seq, const nlohmann::json& args);
     void on_variables(const request_id& request_seq, const nlohmann::json& args);
     void on_continue(const request_id& request_seq, const nlohmann::json& args);
     void on_pause(const request_id& request_seq, const nlohmann::json& args);
@@ -16,6 +16,7 @@
 
 #include <cassert>
 #include <string_view>
+#include <vector>
 
 #include "nlohmann/json.hpp"
 #include "utils/error_codes.h"
@@ -86,6 +87,65 @@ void external_file_reader::read_external_file(
         content.error(utils::error::message_send);
 }
 
+void external_file_reader::read_external_files(std::span<const workspace_manager_external_file_request> requests)
+{
+    if (requests.empty())
+        return;
+
+    auto next_id = m_next_id.fetch_add(1, std::memory_order_relaxed);
+    nlohmann::json urls = nlohmann::json::array();
+    for (const auto& r : requests)
+        urls.push_back(r.url);
+    nlohmann::json msg = {
+        { "id", next_id },
+        { "op", "read_files" },
+        { "urls", std::move(urls) },
+    };
+
+    std::vector<workspace_manager_response<std::string_view>> contents;
+    contents.reserve(requests.size());
+    for (const auto& r : requests)
+        contents.push_back(r.content);
+
+    std::function handler = [contents](bool error, const nlohmann::json& result) noexcept {
+        if (error)
+        {
+            auto [err, errmsg] = extract_error(result);
+            for (const auto& content : contents)
+                content.error(err, errmsg);
+            return;
+        }
+        if (!result.is_array() || result.size() != contents.size())
+        {
+            for (const auto& content : contents)
+                content.error(utils::error::invalid_json);
+            return;
+        }
+        for (size_t i = 0; i < contents.size(); ++i)
+        {
+            const auto& item = result[i];
+            const auto& content = contents[i];
+            if (!item.is_object())
+                content.error(utils::error::invalid_json);
+            else if (auto error_it = item.find("error"); error_it != item.end())
+            {
+                auto [err, errmsg] = extract_error(*error_it);
+                content.error(err, errmsg);
+            }
+            else if (auto data = item.find("data"); data == item.end() || !data->is_string())
+                content.error(utils::error::invalid_json);
+            else
+                content.provide(data->get<std::string_view>());
+        }
+    };
+
+    if (!enqueue_message(next_id, std::move(msg), std::move(handler)))
+    {
+        for (const auto& content : contents)
+            content.error(utils::error::message_send);
+    }
+}
+
 void external_file_reader::read_external_directory(
     std::string_view url, workspace_manager_response<workspace_manager_external_directory_result> members, bool subdir)
 {
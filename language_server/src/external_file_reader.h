@@ -18,6 +18,7 @@
 #include <atomic>
 #include <functional>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <unordered_map>
 #include <utility>
@@ -57,6 +58,8 @@ public:
     void read_external_directory(std::string_view url,
         parser_library::workspace_manager_response<parser_library::workspace_manager_external_directory_result> members,
         bool subdir = false) override;
+    void read_external_files(
+        std::span<const parser_library::workspace_manager_external_file_request> requests) override;
 
     class thread_registration
     {
@@ -23,6 +23,7 @@
 #include "completion_item.h"
 #include "document_symbol_item.h"
 #include "location.h"
+#include "memory_stats.h"
 #include "nlohmann/json.hpp"
 #include "utils/error_codes.h"
 #include "utils/resource_location.h"
@@ -50,6 +51,31 @@ void to_json(nlohmann::json& j, const output_line& ol)
     j["level"] = ol.level;
     j["text"] = ol.text;
 }
+
+void to_json(nlohmann::json& j, const file_memory_stats& fs)
+{
+    j["uri"] = fs.uri;
+    j["lspContext"] = fs.lsp_context;
+    j["semanticTokens"] = fs.semantic_tokens;
+    j["hitCounts"] = fs.hit_counts;
+    j["diagnostics"] = fs.diagnostics;
+    j["preprocessorCache"] = fs.preprocessor_cache;
+}
+
+void to_json(nlohmann::json& j, const workspace_memory_stats& ws)
+{
+    j["uri"] = ws.uri;
+    j["libraryIndexes"] = ws.library_indexes;
+}
+
+void to_json(nlohmann::json& j, const memory_stats& ms)
+{
+    j["idStorage"] = ms.id_storage;
+    j["macroCaches"] = ms.macro_caches;
+    j["fileTexts"] = ms.file_texts;
+    j["workspaces"] = ms.workspaces;
+    j["files"] = ms.files;
+}
 } // namespace hlasm_plugin::parser_library
 
 namespace hlasm_plugin::language_server::lsp {
@@ -250,6 +276,7 @@ void feature_language_features::register_methods(std::map<std::string, method>&
     add_method("textDocument/$/branch_information", &feature_language_features::branch_information);
     add_method("textDocument/foldingRange", &feature_language_features::folding);
     add_method("textDocument/$/retrieve_outputs", &feature_language_features::retrieve_outputs);
+    add_method("$/memory_stats", &feature_language_features::memory_stats);
 }
 
 nlohmann::json feature_language_features::register_capabilities()
@@ -852,4 +879,15 @@ void feature_language_features::retrieve_outputs(const request_id& id, const nlo
     response_->register_cancellable_request(id, std::move(resp));
 }
 
+void feature_language_features::memory_stats(const request_id& id, const nlohmann::json&)
+{
+    auto resp = make_response(id, response_, [](const parser_library::memory_stats& stats) {
+        return nlohmann::json(stats);
+    });
+
+    ws_mngr_.memory_stats(resp);
+
+    response_->register_cancellable_request(id, std::move(resp));
+}
+
 } // namespace hlasm_plugin::language_server::lsp
@@ -53,6 +53,7 @@ private:
     void branch_information(const request_id& id, const nlohmann::json& params);
     void folding(const request_id& id, const nlohmann::json& params);
     void retrieve_outputs(const request_id& id, const nlohmann::json& params);
+    void memory_stats(const request_id& id, const nlohmann::json& params);
 
     nlohmann::json document_symbol_item_json(const hlasm_plugin::parser_library::document_symbol_item& symbol);
     nlohmann::json document_symbol_list_json(
@@ -14,6 +14,8 @@
 
 #include "feature_workspace_folders.h"
 
+#include <algorithm>
+
 #include "../logger.h"
 #include "lib_config.h"
 #include "nlohmann/json.hpp"
@@ -180,6 +182,11 @@ void feature_workspace_folders::configuration(const nlohmann::json& params) cons
             cfg.diag_supress_limit = 0;
     }
     const auto& full_cfg = params[1];
+    if (const auto hlasm = full_cfg.find("hlasm"); hlasm != full_cfg.end() && hlasm->is_object())
+    {
+        if (const auto budget = hlasm->find("memoryBudget"); budget != hlasm->end() && budget->is_number())
+            cfg.memory_budget = std::max<int64_t>(budget->get<int64_t>(), 0);
+    }
 
     ws_mngr_.configuration_changed(cfg, full_cfg.dump());
 }
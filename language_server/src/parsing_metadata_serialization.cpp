@@ -40,6 +40,14 @@ void to_json(nlohmann::json& j, const parser_library::performance_metrics& metri
         { "Reparsed Statements", metrics.reparsed_statements },
         { "Continued Statements", metrics.continued_statements },
         { "Non-continued Statements", metrics.non_continued_statements },
+        { "Open Code Opcode Cache Hits", metrics.open_code_opcode_cache_hits },
+        { "Open Code Opcode Cache Misses", metrics.open_code_opcode_cache_misses },
+        { "Macro Opcode Cache Hits", metrics.macro_opcode_cache_hits },
+        { "Macro Opcode Cache Misses", metrics.macro_opcode_cache_misses },
+        { "Copy Opcode Cache Hits", metrics.copy_opcode_cache_hits },
+        { "Copy Opcode Cache Misses", metrics.copy_opcode_cache_misses },
+        { "Lookahead Opcode Cache Hits", metrics.lookahead_opcode_cache_hits },
+        { "Lookahead Opcode Cache Misses", metrics.lookahead_opcode_cache_misses },
         { "Lines", metrics.lines },
     };
 }
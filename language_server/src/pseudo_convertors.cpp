@@ -106,40 +106,6 @@ constexpr unsigned short ibm278_charset[] = {
 };
 // clang-format on
 
-consteval auto unique_utf8_prefixes(const auto& f, const auto& t)
-{
-    std::array<int, 256> indicators {};
-
-    auto b = std::begin(f);
-    auto d = std::begin(t);
-    for (; b != std::end(f); ++b, ++d)
-    {
-        if (*b == *d)
-            continue;
-        indicators[static_cast<unsigned char>(from_char(*b).data[0])] = 1;
-    }
-
-    return indicators;
-}
-
-template<const auto& f, const auto& t>
-consteval auto enumerate_unique_prefixes()
-{
-    constexpr auto indicators = unique_utf8_prefixes(f, t);
-    constexpr auto ind_cnt = std::accumulate(indicators.begin(), indicators.end(), 0);
-    std::array<char, ind_cnt> result {};
-
-    auto o = result.begin();
-    for (size_t i = 0; i < indicators.size(); ++i)
-    {
-        if (!indicators[i])
-            continue;
-        *o++ = static_cast<char>(i);
-    }
-
-    return result;
-}
-
 template<const auto& f, const auto& t>
 consteval auto generate_conversions()
 {
@@ -165,43 +131,78 @@ consteval auto generate_conversions()
     return result;
 }
 
+// lead byte is the whole converted character, otherwise index into the conversion table
+constexpr unsigned char no_conversion = 0;
+constexpr unsigned char multibyte_conversion = 0xff;
+
+// classifies every byte as a character that is copied, a single byte character with its conversion
+// or a leading byte of multibyte characters that may need conversion
+consteval auto generate_lead_table(const auto& conversions, const auto selector)
+{
+    std::array<unsigned char, 256> result {};
+
+    for (size_t i = 0; i < std::size(conversions); ++i)
+    {
+        const auto& seq = selector(conversions[i]);
+        result[static_cast<unsigned char>(seq.data[0])] =
+            seq.len == 1 ? static_cast<unsigned char>(i + 1) : multibyte_conversion;
+    }
+
+    return result;
+}
+
 template<const auto& f, const auto& t>
 requires(sizeof(f) == sizeof(t)) struct convertor_t final : hlasm_plugin::utils::text_convertor
 {
-    static constexpr std::pair unique_utf8_prefixes = {
-        enumerate_unique_prefixes<f, t>(),
-        enumerate_unique_prefixes<t, f>(),
-    };
-
     static constexpr auto conversions = generate_conversions<f, t>();
+    static_assert(conversions.size() < multibyte_conversion);
+
+    static constexpr std::pair lead_tables = {
+        generate_lead_table(conversions, utils::first_element),
+        generate_lead_table(conversions, utils::second_element),
+    };
 
     void convert(std::string& dst, std::string_view src, const auto from, const auto to) const
     {
-        const auto& prefixes = from(unique_utf8_prefixes);
-        size_t idx = 0;
+        const auto& lead_table = from(lead_tables);
+        const auto needs_conversion = [&lead_table](char c) {
+            return lead_table[static_cast<unsigned char>(c)] != no_conversion;
+        };
+
+        auto it = src.begin();
+        const auto end = src.end();
         while (true)
         {
-            const auto next = src.find_first_of(prefixes.data(), idx, prefixes.size());
-            if (next == std::string_view::npos)
+            const auto next = std::find_if(it, end, needs_conversion);
+            dst.append(it, next);
+            if (next == end)
                 break;
+
+            if (const auto lead = lead_table[static_cast<unsigned char>(*next)]; lead != multibyte_conversion)
+            {
+                const auto& tc = to(conversions[lead - 1]);
+                dst.append(tc.data, tc.len);
+                it = next + 1;
+                continue;
+            }
+
             const auto c = std::ranges::find_if(
                 conversions,
-                [tmp = src.substr(next)](const auto& s) { return tmp.starts_with(std::string_view(s.data, s.len)); },
+                [tmp = std::string_view(next, end)](const auto& s) {
+                    return tmp.starts_with(std::string_view(s.data, s.len));
+                },
                 from);
             if (c == std::ranges::end(conversions))
             {
-                dst.append(src.substr(idx, next - idx + 1));
-                idx = next + 1;
+                dst.push_back(*next);
+                it = next + 1;
                 continue;
             }
             const auto& fc = from(*c);
             const auto& tc = to(*c);
-            dst.append(src.substr(idx, next - idx));
             dst.append(tc.data, tc.len);
-            idx = next + fc.len;
+            it = next + fc.len;
         }
-
-        dst.append(src.substr(idx));
     }
 
     void from(std::string& dst, std::string_view src) const override
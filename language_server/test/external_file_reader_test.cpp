@@ -159,6 +159,57 @@ TEST(external_file_reader, file_reading_error)
 })"_json);
 }
 
+TEST(external_file_reader, bulk_file_reading)
+{
+    NiceMock<mock_json_sink> sink;
+    MockFunction<void()> wakeup;
+
+    auto [r1, resp1] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    auto [r2, resp2] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    auto [r3, resp3] = make_workspace_manager_response(
+        std::in_place_type<NiceMock<workspace_manager_response_mock<std::string_view>>>);
+    external_file_reader reader(sink);
+
+    auto reg = reader.register_thread(wakeup.AsStdFunction());
+
+    EXPECT_CALL(sink,
+        write_rvr(
+            R"(
+{
+  "jsonrpc": "2.0",
+  "method":"external_file_request",
+  "params":{
+    "id":1,
+    "op":"read_files",
+    "urls":["AAA","BBB","CCC"]
+  }
+})"_json));
+
+    const workspace_manager_external_file_request requests[] = {
+        { "AAA", r1 },
+        { "BBB", r2 },
+        { "CCC", r3 },
+    };
+    reader.read_external_files(requests);
+
+    EXPECT_CALL(*resp1, provide(Truly([](std::string_view v) { return v == "AAACONTENT"; })));
+    EXPECT_CALL(*resp2, error(0, StrEq("Not found")));
+    EXPECT_CALL(*resp3, error(_, _));
+    EXPECT_CALL(wakeup, Call());
+
+    reader.write(R"(
+{
+  "jsonrpc": "2.0",
+  "method":"external_file_response",
+  "params":{
+    "id":1,
+    "data":[{"data":"AAACONTENT"},{"error":{"code":0,"msg":"Not found"}},{}]
+  }
+})"_json);
+}
+
 TEST(external_file_reader, directory_reading)
 {
     NiceMock<mock_json_sink> sink;
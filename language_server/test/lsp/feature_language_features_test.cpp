@@ -543,3 +543,29 @@ TEST(language_features, retrieve_output_empty)
 
     ws_mngr->idle_handler();
 }
+
+TEST(language_features, memory_stats)
+{
+    auto ws_mngr = parser_library::create_workspace_manager();
+    response_provider_mock response_mock;
+    lsp::feature_language_features f(*ws_mngr, response_mock, nullptr);
+    std::map<std::string, method> notifs;
+    f.register_methods(notifs);
+
+    ws_mngr->did_open_file(uri, 0, " LR 1,1");
+    ws_mngr->idle_handler();
+
+    nlohmann::json response;
+    EXPECT_CALL(response_mock, respond(request_id(0), StrEq(""), _)).WillOnce(SaveArg<2>(&response));
+    notifs["$/memory_stats"].as_request_handler()(request_id(0), nlohmann::json::object());
+
+    ASSERT_TRUE(response.is_object());
+    EXPECT_GT(response.at("idStorage").get<size_t>(), 0);
+    EXPECT_GT(response.at("fileTexts").get<size_t>(), 0);
+    EXPECT_EQ(response.at("workspaces").size(), 1);
+
+    const auto& files = response.at("files");
+    ASSERT_EQ(files.size(), 1);
+    EXPECT_EQ(files[0].at("uri"), uri);
+    EXPECT_GT(files[0].at("lspContext").get<size_t>(), 0);
+}
@@ -12,9 +12,18 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "pseudo_convertors.h"
+#include "utils/text_convertor.h"
 
 using namespace hlasm_plugin::language_server;
 
@@ -60,3 +69,133 @@ TEST(pseudo_convertors, ibm1143_prefix_match_without_conversion)
     convertor->from(output, input);
     EXPECT_EQ(output, input);
 }
+
+TEST(pseudo_convertors, ibm1143_mixed_text)
+{
+    const auto* convertor = get_text_convertor(pseudo_charsets::ibm1143);
+    ASSERT_TRUE(convertor);
+
+    const std::string input = reinterpret_cast<const char*>(
+        u8"LABEL    DC    C'\U000000C5\U000000C4\U000000D6\U000020AB'   long comment text");
+    std::string output;
+    convertor->from(output, input);
+    EXPECT_EQ(output, reinterpret_cast<const char*>(u8"LABEL    DC    C'$#@\U000020AB'   long comment text"));
+
+    std::string back;
+    convertor->to(back, output);
+    EXPECT_EQ(back, input);
+}
+
+namespace {
+std::string utf8(unsigned short c)
+{
+    if (c < 0x80)
+        return std::string(1, static_cast<char>(c));
+    else if (c < 0x800)
+        return { static_cast<char>(0xc0 | c >> 6), static_cast<char>(0x80 | (c & 0b111111)) };
+    else
+        return {
+            static_cast<char>(0xe0 | c >> 12),
+            static_cast<char>(0x80 | ((c >> 6) & 0b111111)),
+            static_cast<char>(0x80 | (c & 0b111111)),
+        };
+}
+
+// Conversions performed by convertor::from, recovered from its inverse over the basic multilingual plane
+std::vector<std::pair<std::string, std::string>> probe_conversions(const hlasm_plugin::utils::text_convertor& convertor)
+{
+    std::vector<std::pair<std::string, std::string>> result;
+    for (unsigned c = 0; c < 0x10000; ++c)
+    {
+        if (c >= 0xd800 && c < 0xe000)
+            continue;
+        auto pseudo = utf8(static_cast<unsigned short>(c));
+        std::string original;
+        convertor.to(original, pseudo);
+        if (original != pseudo)
+            result.emplace_back(std::move(original), std::move(pseudo));
+    }
+    return result;
+}
+
+// The convertor before the lead byte table, every position was matched with find_first_of over the leading bytes
+void convert_by_prefixes(
+    std::string& dst, std::string_view src, const std::vector<std::pair<std::string, std::string>>& conversions)
+{
+    std::string prefixes;
+    for (const auto& [f, _] : conversions)
+        if (prefixes.find(f.front()) == std::string::npos)
+            prefixes.push_back(f.front());
+
+    size_t idx = 0;
+    while (true)
+    {
+        const auto next = src.find_first_of(prefixes, idx);
+        if (next == std::string_view::npos)
+            break;
+        const auto c = std::ranges::find_if(
+            conversions, [tmp = src.substr(next)](const auto& s) { return tmp.starts_with(s.first); });
+        if (c == conversions.end())
+        {
+            dst.append(src.substr(idx, next - idx + 1));
+            idx = next + 1;
+            continue;
+        }
+        dst.append(src.substr(idx, next - idx));
+        dst.append(c->second);
+        idx = next + c->first.size();
+    }
+
+    dst.append(src.substr(idx));
+}
+
+template<typename F>
+double megabytes_per_second(size_t size, F&& f)
+{
+    auto best = std::chrono::steady_clock::duration::max();
+    for (int i = 0; i < 5; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+    }
+    return size / std::chrono::duration<double>(best).count() / (1 << 20);
+}
+} // namespace
+
+// Throughput of the current and the previous convertor, run with --gtest_also_run_disabled_tests
+TEST(pseudo_convertors, DISABLED_throughput)
+{
+    const auto* convertor = get_text_convertor(pseudo_charsets::ibm1143);
+    ASSERT_TRUE(convertor);
+
+    const auto conversions = probe_conversions(*convertor);
+    ASSERT_FALSE(conversions.empty());
+
+    const std::string plain_line = "LABEL    DC    C'ABCDEF'   long comment text to make the line longer\n";
+    const std::string national_line = reinterpret_cast<const char*>(
+        u8"LABEL    DC    C'\U000000C5\U000000C4\U000000D6\U000020AB'   long comment text with \U000000E5\U000000E4\n");
+
+    std::string input;
+    while (input.size() < (16 << 20))
+    {
+        for (int i = 0; i < 7; ++i)
+            input.append(plain_line);
+        input.append(national_line);
+    }
+
+    std::string current;
+    std::string previous;
+    const auto current_mbps = megabytes_per_second(input.size(), [&]() {
+        current.clear();
+        convertor->from(current, input);
+    });
+    const auto previous_mbps = megabytes_per_second(input.size(), [&]() {
+        previous.clear();
+        convert_by_prefixes(previous, input, conversions);
+    });
+
+    EXPECT_EQ(current, previous);
+
+    std::cout << "ibm1143 from: current " << current_mbps << " MB/s, previous " << previous_mbps << " MB/s\n";
+}
@@ -17,6 +17,7 @@
 
 #include "gmock/gmock.h"
 
+#include "memory_stats.h"
 #include "workspace_manager.h"
 #include "workspace_manager_response.h"
 
@@ -112,6 +113,8 @@ public:
         (std::string_view document_uri, workspace_manager_response<std::span<const output_line>> resp),
         (override));
 
+    MOCK_METHOD(void, memory_stats, (workspace_manager_response<const parser_library::memory_stats&> resp), (override));
+
     MOCK_METHOD(void, change_implicit_group_base, (std::string_view uri), (override));
 };
 
@@ -35,6 +35,7 @@
 
 namespace hlasm_plugin::utils {
 class task;
+class time_source;
 template<std::move_constructible T>
 class value_task;
 } // namespace hlasm_plugin::utils
@@ -50,6 +51,7 @@ class parser_holder;
 
 namespace hlasm_plugin::parser_library::processing {
 class preprocessor;
+class preprocessor_cache;
 class statement_analyzer;
 } // namespace hlasm_plugin::parser_library::processing
 
@@ -75,6 +77,12 @@ enum class collect_highlighting_info : bool
     yes,
 };
 
+enum class collect_occurrences_info : bool
+{
+    no,
+    yes,
+};
+
 enum class file_is_opencode : bool
 {
     no,
@@ -105,9 +113,11 @@ class analyzer_options
     parse_lib_provider* lib_provider = nullptr;
     std::variant<asm_option, analyzing_context> ctx_source;
     collect_highlighting_info collect_hl_info = collect_highlighting_info::no;
+    collect_occurrences_info collect_occurrences = collect_occurrences_info::yes;
     file_is_opencode parsing_opencode = file_is_opencode::no;
     std::shared_ptr<context::id_storage> ids_init;
     std::vector<preprocessor_options> preprocessor_args;
+    std::shared_ptr<processing::preprocessor_cache> pp_cache;
     virtual_file_monitor* vf_monitor = nullptr;
     std::shared_ptr<std::vector<fade_message>> fade_messages = nullptr;
     output_handler* output = nullptr;
@@ -115,16 +125,19 @@ class analyzer_options
     processing::processing_kind dep_kind = processing::processing_kind::ORDINARY;
     diagnostic_limit diag_limit;
     external_functions_list external_functions;
+    utils::time_source* time_src = nullptr;
 
     void set(utils::resource::resource_location rl) { file_loc = std::move(rl); }
     void set(parse_lib_provider* lp) { lib_provider = lp; }
     void set(asm_option ao) { ctx_source = std::move(ao); }
     void set(analyzing_context ac) { ctx_source = std::move(ac); }
     void set(collect_highlighting_info hi) { collect_hl_info = hi; }
+    void set(collect_occurrences_info oi) { collect_occurrences = oi; }
     void set(file_is_opencode f_oc) { parsing_opencode = f_oc; }
     void set(std::shared_ptr<context::id_storage> ids) { ids_init = std::move(ids); }
     void set(preprocessor_options pp) { preprocessor_args.push_back(std::move(pp)); }
     void set(std::vector<preprocessor_options> pp) { preprocessor_args = std::move(pp); }
+    void set(std::shared_ptr<processing::preprocessor_cache> ppc) { pp_cache = std::move(ppc); }
     void set(virtual_file_monitor* vfm) { vf_monitor = vfm; }
     void set(std::shared_ptr<std::vector<fade_message>> fmc) { fade_messages = fmc; };
     void set(output_handler* o) { output = o; }
@@ -135,6 +148,7 @@ class analyzer_options
     }
     void set(diagnostic_limit dl) { diag_limit = dl; }
     void set(external_functions_list ef) { external_functions = std::move(ef); }
+    void set(utils::time_source* ts) { time_src = ts; }
 
     context::hlasm_context& get_hlasm_context();
     analyzing_context& get_context();
@@ -160,10 +174,13 @@ public:
         constexpr auto ao_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, asm_option>);
         constexpr auto ac_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, analyzing_context>);
         constexpr auto hi_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, collect_highlighting_info>);
+        constexpr auto oi_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, collect_occurrences_info>);
         constexpr auto f_oc_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, file_is_opencode>);
         constexpr auto ids_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, std::shared_ptr<context::id_storage>>);
         constexpr auto pp_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, preprocessor_options>)+(
             0 + ... + std::is_same_v<std::decay_t<Args>, std::vector<preprocessor_options>>);
+        constexpr auto ppc_cnt =
+            (0 + ... + std::is_same_v<std::decay_t<Args>, std::shared_ptr<processing::preprocessor_cache>>);
         constexpr auto vfm_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, virtual_file_monitor*>);
         constexpr auto fmc_cnt =
             (0 + ... + std::is_same_v<std::decay_t<Args>, std::shared_ptr<std::vector<fade_message>>>);
@@ -171,26 +188,30 @@ public:
         constexpr auto dep_data_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, dependency_data>);
         constexpr auto diag_limit_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, diagnostic_limit>);
         constexpr auto ef_cnt = (0 + ... + std::is_same_v<std::decay_t<Args>, external_functions_list>);
-        constexpr auto cnt = rl_cnt + lib_cnt + ao_cnt + ac_cnt + hi_cnt + f_oc_cnt + ids_cnt + pp_cnt + vfm_cnt
-            + fmc_cnt + o_cnt + dep_data_cnt + diag_limit_cnt + ef_cnt;
+        constexpr auto ts_cnt = (0 + ... + std::is_convertible_v<std::decay_t<Args>, utils::time_source*>);
+        constexpr auto cnt = rl_cnt + lib_cnt + ao_cnt + ac_cnt + hi_cnt + oi_cnt + f_oc_cnt + ids_cnt + pp_cnt
+            + ppc_cnt + vfm_cnt + fmc_cnt + o_cnt + dep_data_cnt + diag_limit_cnt + ef_cnt + ts_cnt;
 
         static_assert(rl_cnt <= 1, "Duplicate resource_location");
         static_assert(lib_cnt <= 1, "Duplicate parse_lib_provider");
         static_assert(ao_cnt <= 1, "Duplicate asm_option");
         static_assert(ac_cnt <= 1, "Duplicate analyzing_context");
         static_assert(hi_cnt <= 1, "Duplicate collect_highlighting_info");
+        static_assert(oi_cnt <= 1, "Duplicate collect_occurrences_info");
         static_assert(f_oc_cnt <= 1, "Duplicate file_is_opencode");
         static_assert(ids_cnt <= 1, "Duplicate id_storage");
         static_assert(pp_cnt <= 1, "Duplicate preprocessor_args");
+        static_assert(ppc_cnt <= 1, "Duplicate preprocessor_cache");
         static_assert(vfm_cnt <= 1, "Duplicate virtual_file_monitor");
         static_assert(fmc_cnt <= 1, "Duplicate fade message container");
-        static_assert(!(ac_cnt && (ao_cnt || ids_cnt || pp_cnt || ef_cnt)),
-            "Do not specify both analyzing_context and asm_option, id_storage, preprocessor_args or "
-            "external_functions");
+        static_assert(!(ac_cnt && (ao_cnt || ids_cnt || pp_cnt || ef_cnt || ts_cnt)),
+            "Do not specify both analyzing_context and asm_option, id_storage, preprocessor_args, "
+            "external_functions or time_source");
         static_assert(o_cnt <= 1, "Duplicate output_handler");
         static_assert(dep_data_cnt <= 1, "Duplicate dependency_data");
         static_assert(diag_limit_cnt <= 1, "Duplicate diagnostic_limit");
         static_assert(ef_cnt <= 1, "Duplicate external_functions");
+        static_assert(ts_cnt <= 1, "Duplicate time_source");
         static_assert(cnt == sizeof...(Args), "Unrecognized argument provided");
 
         (set(std::forward<Args>(args)), ...);
@@ -65,6 +65,9 @@ public:
     void disconnect();
     void continue_debug();
     void pause();
+    // Reverse execution, the analysis is replayed from the start up to the target statement.
+    void step_back();
+    void reverse_continue();
 
     void breakpoints(std::string_view source, std::span<const breakpoint> bps);
     [[nodiscard]] std::span<const breakpoint> breakpoints(std::string_view source) const;
@@ -29,6 +29,12 @@ struct replaced_line
     std::string m_text;
 };
 
+// Line that does not come from the document, its text is owned elsewhere and must outlive the document
+struct borrowed_line
+{
+    std::string_view m_text;
+};
+
 struct original_line
 {
     std::string_view m_text;
@@ -37,7 +43,7 @@ struct original_line
 
 class document_line
 {
-    std::variant<original_line, replaced_line> m_line;
+    std::variant<original_line, replaced_line, borrowed_line> m_line;
 
 public:
     explicit document_line(original_line l) noexcept
@@ -46,6 +52,9 @@ public:
     explicit document_line(replaced_line l) noexcept
         : m_line(std::move(l))
     {}
+    explicit document_line(borrowed_line l) noexcept
+        : m_line(std::move(l))
+    {}
 
     std::string_view text() const noexcept
     {
@@ -89,7 +98,8 @@ public:
 
     const auto& at(size_t idx) const { return m_lines.at(idx); }
 
-    void convert_to_replaced();
+    // Drops the line numbers without copying the text, which must therefore outlive the document
+    void convert_to_borrowed() noexcept;
 };
 
 } // namespace hlasm_plugin::parser_library
@@ -28,6 +28,8 @@ struct lib_config
     [[nodiscard]] lib_config fill_missing_settings(const lib_config& second) const;
 
     std::optional<int64_t> diag_supress_limit;
+    // Memory in megabytes retained for analysis results of open programs, 0 means unlimited
+    std::optional<int64_t> memory_budget;
 
     bool operator==(const lib_config&) const noexcept = default;
 };
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_PARSERLIBRARY_MEMORY_STATS_H
+#define HLASMPLUGIN_PARSERLIBRARY_MEMORY_STATS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace hlasm_plugin::parser_library {
+
+// Approximate memory (in bytes) retained by individual components of the language server
+
+struct file_memory_stats
+{
+    std::string uri;
+    std::size_t lsp_context = 0;
+    std::size_t semantic_tokens = 0;
+    std::size_t hit_counts = 0;
+    std::size_t diagnostics = 0;
+    std::size_t preprocessor_cache = 0;
+
+    bool operator==(const file_memory_stats&) const noexcept = default;
+};
+
+struct workspace_memory_stats
+{
+    std::string uri;
+    std::size_t library_indexes = 0;
+
+    bool operator==(const workspace_memory_stats&) const noexcept = default;
+};
+
+struct memory_stats
+{
+    std::size_t id_storage = 0;
+    std::size_t macro_caches = 0;
+    std::size_t file_texts = 0;
+
+    std::vector<workspace_memory_stats> workspaces;
+    std::vector<file_memory_stats> files;
+
+    bool operator==(const memory_stats&) const noexcept = default;
+};
+
+} // namespace hlasm_plugin::parser_library
+
+#endif
@@ -23,7 +23,9 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
 #include <string_view>
+#include <vector>
 
 #include "range.h"
 
@@ -92,16 +94,35 @@ struct performance_metrics
     size_t lookahead_statements = 0;
     size_t continued_statements = 0;
     size_t non_continued_statements = 0;
+    size_t open_code_opcode_cache_hits = 0;
+    size_t open_code_opcode_cache_misses = 0;
+    size_t macro_opcode_cache_hits = 0;
+    size_t macro_opcode_cache_misses = 0;
+    size_t copy_opcode_cache_hits = 0;
+    size_t copy_opcode_cache_misses = 0;
+    size_t lookahead_opcode_cache_hits = 0;
+    size_t lookahead_opcode_cache_misses = 0;
 
     bool operator==(const performance_metrics&) const noexcept = default;
 };
 
+struct library_lookup
+{
+    std::string name;
+    std::string uri; // empty when the member was not found
+};
+
 struct workspace_file_info
 {
     size_t files_processed = 0;
     bool config_parsing = false;
     bool diagnostics_suppressed = false;
     bool processor_group_found = false;
+
+    // Filled only when requested by workspace_manager_args::report_dependencies
+    std::vector<std::string> dependencies; // uris of all library members read by the analysis
+    std::vector<library_lookup> library_lookups; // all member lookups, including the failed ones
+    std::vector<std::string> libraries; // uris of the libraries the members are looked up in
 };
 
 struct parsing_metadata
@@ -41,6 +41,7 @@ struct completion_item;
 struct diagnostic;
 struct document_symbol_item;
 struct fade_message;
+struct memory_stats;
 class workspace_manager_external_file_requests;
 class external_configuration_requests;
 class watcher_registration_provider;
@@ -182,6 +183,8 @@ public:
     virtual void retrieve_output(
         std::string_view document_uri, workspace_manager_response<std::span<const output_line>> resp) = 0;
 
+    virtual void memory_stats(workspace_manager_response<const parser_library::memory_stats&> resp) = 0;
+
     virtual void change_implicit_group_base(std::string_view uri) = 0;
 };
 
@@ -190,6 +193,8 @@ struct workspace_manager_args
     workspace_manager_external_file_requests* external_requests = nullptr;
     const utils::text_convertor* text_conversion = nullptr;
     bool vscode_extensions = false;
+    // Lists the library members and lookups of analyzed programs in their parsing metadata
+    bool report_dependencies = false;
 };
 
 workspace_manager* create_workspace_manager_impl(const workspace_manager_args& args);
@@ -27,6 +27,12 @@ struct workspace_manager_external_directory_result
     std::span<const std::string_view> member_urls;
 };
 
+struct workspace_manager_external_file_request
+{
+    std::string_view url;
+    workspace_manager_response<std::string_view> content;
+};
+
 class workspace_manager_external_file_requests
 {
 protected:
@@ -37,6 +43,14 @@ public:
     virtual void read_external_directory(std::string_view url,
         workspace_manager_response<workspace_manager_external_directory_result> members,
         bool subdir = false) = 0;
+
+    // Requests several files at once, so that they can be delivered in bulk.
+    // The default implementation requests the files one by one.
+    virtual void read_external_files(std::span<const workspace_manager_external_file_request> requests)
+    {
+        for (const auto& r : requests)
+            read_external_file(r.url, r.content);
+    }
 };
 
 } // namespace hlasm_plugin::parser_library
@@ -22,6 +22,7 @@
 #include "parse_lib_provider.h"
 #include "processing/opencode_provider.h"
 #include "processing/preprocessor.h"
+#include "processing/preprocessor_cache.h"
 #include "processing/processing_manager.h"
 #include "semantics/source_info_processor.h"
 #include "utils/task.h"
@@ -34,7 +35,8 @@ analyzing_context& analyzer_options::get_context()
     {
         auto h_ctx = std::make_shared<context::hlasm_context>(file_loc,
             std::move(std::get<asm_option>(ctx_source)),
-            ids_init ? std::move(ids_init) : std::make_shared<context::id_storage>());
+            ids_init ? std::move(ids_init) : std::make_shared<context::id_storage>(),
+            time_src);
 
         for (auto&& [name, func] : external_functions)
         {
@@ -64,52 +66,11 @@ std::unique_ptr<processing::preprocessor> analyzer_options::get_preprocessor(pro
     diagnostic_op_consumer& diag_consumer,
     semantics::source_info_processor& src_proc) const
 {
-    const auto transform_preprocessor = [&asm_lf, &diag_consumer, &src_proc](const preprocessor_options& po) {
-        return std::visit(
-            [&asm_lf, &diag_consumer, &src_proc](const auto& p) -> std::unique_ptr<processing::preprocessor> {
-                return processing::preprocessor::create(p, asm_lf, &diag_consumer, src_proc);
-            },
-            po);
-    };
-    if (preprocessor_args.empty())
-        return {};
-    else if (preprocessor_args.size() == 1)
-        return transform_preprocessor(preprocessor_args.front());
-
-    struct combined_preprocessor final : processing::preprocessor
-    {
-        std::vector<std::unique_ptr<processing::preprocessor>> pp;
-
-        [[nodiscard]] utils::value_task<document> generate_replacement(document doc) override
-        {
-            reset();
-
-            for (const auto& p : pp)
-                doc = co_await p->generate_replacement(std::move(doc));
-
-            co_return doc;
-        }
-
-        std::vector<std::shared_ptr<semantics::preprocessor_statement_si>> take_statements() override
-        {
-            for (const auto& p : pp)
-                set_statements(p->take_statements());
-
-            return preprocessor::take_statements();
-        }
-
-        const std::vector<std::unique_ptr<included_member_details>>& view_included_members() override
-        {
-            for (const auto& p : pp)
-                capture_included_members(*p);
-
-            return preprocessor::view_included_members();
-        }
-    } tmp;
-
-    std::ranges::transform(preprocessor_args, std::back_inserter(tmp.pp), transform_preprocessor);
+    if (pp_cache && !preprocessor_args.empty())
+        return processing::preprocessor_cache::create_preprocessor(
+            pp_cache, preprocessor_args, std::move(asm_lf), &diag_consumer, src_proc);
 
-    return std::make_unique<combined_preprocessor>(std::move(tmp));
+    return processing::preprocessor::create(preprocessor_args, std::move(asm_lf), &diag_consumer, src_proc);
 }
 
 struct analyzer::impl final
@@ -141,7 +102,8 @@ struct analyzer::impl final
               field_parser,
               std::move(opts.fade_messages),
               opts.output,
-              diag_ctx)
+              diag_ctx,
+              opts.collect_occurrences == collect_occurrences_info::yes)
     {}
 
     diagnosable_ctx diag_ctx;
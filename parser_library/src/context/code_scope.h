@@ -15,11 +15,14 @@
 #ifndef CONTEXT_CODE_SCOPE_H
 #define CONTEXT_CODE_SCOPE_H
 
+#include <unordered_map>
 #include <variant>
+#include <vector>
 
 #include "context/source_context.h"
 #include "macro.h"
 #include "utils/time.h"
+#include "variable_slots.h"
 #include "variables/set_symbol.h"
 
 namespace hlasm_plugin::parser_library::context {
@@ -74,6 +77,10 @@ struct code_scope
     A_t branch_counter = 4096;
     // stack at the time of enter_macro
     processing_stack_t stack = {};
+    // slot assignment shared by all scopes executing the same code
+    variable_slot_table* slot_table = nullptr;
+    // variables and macro parameters already resolved, indexed by slot
+    mutable std::vector<variable_symbol*> slots;
 
     bool is_in_macro() const { return !!this_macro; }
 
@@ -14,6 +14,7 @@
 
 #include "hlasm_context.h"
 
+#include <algorithm>
 #include <ctime>
 #include <format>
 #include <memory>
@@ -345,17 +346,22 @@ void hlasm_context::add_scoped_system_variables(
         id_index("SYSCLOCK"), create_dynamic_var([view]() { return view.top().time.to_string(); }), false));
 }
 
-hlasm_context::hlasm_context(
-    utils::resource::resource_location file_loc, asm_option asm_options, std::shared_ptr<id_storage> init_ids)
+hlasm_context::hlasm_context(utils::resource::resource_location file_loc,
+    asm_option asm_options,
+    std::shared_ptr<id_storage> init_ids,
+    utils::time_source* time_source)
     : ids_(std::move(init_ids))
     , opencode_file_location_(file_loc)
     , asm_options_(std::move(asm_options))
+    , time_source_(time_source)
     , m_usings(std::make_unique<using_collection>())
     , m_active_usings(1, m_usings->remove_all())
     , m_statements_remaining(asm_options_.statement_count_limit)
     , ord_ctx(*this)
 {
-    scope_stack_.emplace_back().time = utils::timestamp::now().value_or(utils::timestamp { 1900, 1, 1 });
+    auto& opencode_scope = scope_stack_.emplace_back();
+    opencode_scope.time = current_time();
+    opencode_scope.slot_table = &opencode_variable_slots_;
 
     init_instruction_map(opcode_mnemo_, *ids_, asm_options_.instr_set);
 
@@ -367,6 +373,13 @@ hlasm_context::hlasm_context(
 
 hlasm_context::~hlasm_context() = default;
 
+utils::timestamp hlasm_context::current_time() const
+{
+    if (time_source_)
+        return time_source_->now();
+    return utils::timestamp::now().value_or(utils::timestamp { 1900, 1, 1 });
+}
+
 void hlasm_context::set_source_position(position pos) { source_stack_.back().current_instruction.pos = pos; }
 
 void hlasm_context::set_source_indices(size_t begin_index, size_t end_index)
@@ -550,23 +563,58 @@ std::vector<id_index> hlasm_context::whole_copy_stack() const
 
 const hlasm_context::global_variable_storage& hlasm_context::globals() const { return globals_; }
 
-variable_symbol* hlasm_context::get_var_sym(
-    id_index name, const code_scope& scope, const system_variable_map& sysvars) const
+namespace {
+// returns the variable symbol and whether it is owned by the scope
+std::pair<variable_symbol*, bool> find_var_sym(
+    id_index name, const code_scope& scope, const system_variable_map& sysvars)
 {
     if (auto tmp = scope.variables.find(name); tmp != scope.variables.end())
-        return tmp->second.ref;
+        return { tmp->second.ref, true };
 
     if (auto s = sysvars.find(name); s && (scope.is_in_macro() || s->second.second))
-        return s->second.first.get();
+        return { s->second.first.get(), false };
 
     if (scope.is_in_macro())
     {
         auto m_tmp = scope.this_macro->named_params.find(name);
         if (m_tmp != scope.this_macro->named_params.end())
-            return m_tmp->second.get();
+            return { m_tmp->second.get(), true };
     }
 
-    return nullptr;
+    return { nullptr, false };
+}
+} // namespace
+
+variable_symbol* hlasm_context::get_var_sym(
+    id_index name, const code_scope& scope, const system_variable_map& sysvars) const
+{
+    return find_var_sym(name, scope, sysvars).first;
+}
+
+variable_symbol* hlasm_context::get_var_sym(
+    id_index name, const code_scope& scope, const system_variable_map& sysvars, variable_slot_hint& hint) const
+{
+    if (!scope.slot_table)
+        return get_var_sym(name, scope, sysvars);
+
+    if (hint.table != scope.slot_table)
+        hint = { scope.slot_table, scope.slot_table->slot(name) };
+
+    if (hint.index < scope.slots.size())
+    {
+        if (auto* var = scope.slots[hint.index]; var && var->id == name)
+            return var;
+    }
+
+    auto [var, owned] = find_var_sym(name, scope, sysvars);
+    if (owned)
+    {
+        if (hint.index >= scope.slots.size())
+            scope.slots.resize(hint.index + 1);
+        scope.slots[hint.index] = var;
+    }
+
+    return var;
 }
 variable_symbol* hlasm_context::get_var_sym(id_index name) const
 {
@@ -652,9 +700,34 @@ const opcode_t* hlasm_context::search_opcodes(id_index name, Pred p, Proj proj)
     return &op->first;
 }
 
+namespace {
+// hits and misses of the opcode cache indexed by hlasm_context::opcode_lookup_phase
+constexpr std::pair<size_t performance_metrics::*, size_t performance_metrics::*> opcode_cache_counters[] = {
+    { &performance_metrics::open_code_opcode_cache_hits, &performance_metrics::open_code_opcode_cache_misses },
+    { &performance_metrics::macro_opcode_cache_hits, &performance_metrics::macro_opcode_cache_misses },
+    { &performance_metrics::copy_opcode_cache_hits, &performance_metrics::copy_opcode_cache_misses },
+    { &performance_metrics::lookahead_opcode_cache_hits, &performance_metrics::lookahead_opcode_cache_misses },
+};
+} // namespace
+
 const opcode_t* hlasm_context::search_opcodes(id_index name, opcode_generation gen) const
 {
-    return search_opcodes(name, [gen](const auto& e) { return e.second <= gen; });
+    // all later generations see the same opcodes as the current one
+    gen = std::min(gen, m_current_opcode_generation);
+
+    const auto [hits, misses] = opcode_cache_counters[static_cast<unsigned char>(opcode_phase)];
+    auto& entry = m_opcode_cache[std::hash<id_index>()(name) % opcode_cache_size];
+    if (entry.filled_in == m_current_opcode_generation && entry.gen == gen && entry.name == name)
+    {
+        ++(metrics.*hits);
+        return entry.op;
+    }
+    ++(metrics.*misses);
+
+    const auto* op = search_opcodes(name, [gen](const auto& e) { return e.second <= gen; });
+    entry = { name, gen, m_current_opcode_generation, op };
+
+    return op;
 }
 
 const opcode_t* hlasm_context::find_opcode_mnemo(
@@ -887,11 +960,12 @@ std::pair<const macro_invocation*, bool> hlasm_context::enter_macro(
     auto* const result = invo.get();
 
     auto& new_scope = scope_stack_.emplace_back(std::move(invo));
-    new_scope.time = utils::timestamp::now().value_or(utils::timestamp { 1900, 1, 1 });
+    new_scope.time = current_time();
     new_scope.sysndx = SYSNDX_;
     if (auto sect = ord_ctx.current_section(); sect)
         new_scope.loctr = &sect->current_location_counter();
     new_scope.stack = stack;
+    new_scope.slot_table = &macro_def->variable_slots;
 
     ++SYSNDX_;
 
@@ -972,6 +1046,7 @@ set_symbol_base* hlasm_context::create_global_variable(id_index id, bool is_scal
         return nullptr;
 
     scope->variables.try_emplace(id, &std::get<set_symbol<T>>(it->second), true);
+    scope->slots.clear();
 
     return &std::get<set_symbol<T>>(it->second);
 }
@@ -983,8 +1058,10 @@ template set_symbol_base* hlasm_context::create_global_variable<C_t>(id_index id
 template<typename T>
 set_symbol_base* hlasm_context::create_local_variable(id_index id, bool is_scalar)
 {
-    return curr_scope()
-        ->variables.try_emplace(id, std::in_place_type<T>, id, is_scalar, false)
+    auto* scope = curr_scope();
+    scope->slots.clear();
+
+    return scope->variables.try_emplace(id, std::in_place_type<T>, id, is_scalar, false)
         .first->second.ref->template access_set_symbol<T>();
 }
 
@@ -1154,12 +1231,21 @@ variable_symbol* get_var_sym(const expressions::evaluation_context& eval_ctx, id
         name, eval_ctx.active_scope(), eval_ctx.sysvars ? *eval_ctx.sysvars : eval_ctx.hlasm_ctx.system_variables);
 }
 
+variable_symbol* get_var_sym(const expressions::evaluation_context& eval_ctx, id_index name, variable_slot_hint& hint)
+{
+    return eval_ctx.hlasm_ctx.get_var_sym(name,
+        eval_ctx.active_scope(),
+        eval_ctx.sysvars ? *eval_ctx.sysvars : eval_ctx.hlasm_ctx.system_variables,
+        hint);
+}
+
 SET_t get_var_sym_value(const expressions::evaluation_context& eval_ctx,
     id_index name,
     std::span<const context::A_t> subscript,
-    range symbol_range)
+    range symbol_range,
+    variable_slot_hint* hint)
 {
-    auto var = get_var_sym(eval_ctx, name);
+    auto var = hint ? get_var_sym(eval_ctx, name, *hint) : get_var_sym(eval_ctx, name);
     if (!test_symbol_for_read(var, subscript, symbol_range, eval_ctx.diags, name.to_string_view()))
         return SET_t();
 
@@ -15,6 +15,7 @@
 #ifndef CONTEXT_HLASM_CONTEXT_H
 #define CONTEXT_HLASM_CONTEXT_H
 
+#include <array>
 #include <cassert>
 #include <deque>
 #include <memory>
@@ -97,9 +98,23 @@ private:
     opcode_map opcode_mnemo_;
     opcode_generation m_current_opcode_generation = opcode_generation::zero;
 
+    // direct-mapped cache of opcode lookups, every change of opcode_mnemo_ bumps the generation and invalidates it
+    struct opcode_cache_entry
+    {
+        id_index name;
+        opcode_generation gen = opcode_generation::zero;
+        opcode_generation filled_in = opcode_generation::current;
+        const opcode_t* op = nullptr;
+    };
+    static constexpr size_t opcode_cache_size = 256;
+    mutable std::array<opcode_cache_entry, opcode_cache_size> m_opcode_cache;
+
     // storage of identifiers
     std::shared_ptr<id_storage> ids_;
 
+    // slots of variables referenced in the open code
+    variable_slot_table opencode_variable_slots_;
+
     // stack of nested scopes
     std::deque<code_scope> scope_stack_;
     code_scope* curr_scope();
@@ -112,6 +127,9 @@ private:
 
     // Compiler options
     asm_option asm_options_;
+    // Source of the scope creation times, the current time when not provided
+    utils::time_source* time_source_;
+    utils::timestamp current_time() const;
     static constexpr alignment sectalgn = doubleword;
 
     // map of active instructions in HLASM
@@ -148,6 +166,11 @@ private:
 
     // return variable symbol from an arbitrary scope
     variable_symbol* get_var_sym(id_index name, const code_scope& scope, const system_variable_map& sysvars) const;
+    // same as above, resolves the variable through the scope slots first
+    variable_symbol* get_var_sym(id_index name,
+        const code_scope& scope,
+        const system_variable_map& sysvars,
+        variable_slot_hint& hint) const;
 
     template<typename Pred, typename Proj = std::identity>
     const opcode_t* search_opcodes(id_index name, Pred p, Proj proj = Proj()) const;
@@ -163,7 +186,8 @@ public:
 
     hlasm_context(utils::resource::resource_location file_loc = utils::resource::resource_location(""),
         asm_option asm_opts = {},
-        std::shared_ptr<id_storage> init_ids = make_default_id_storage());
+        std::shared_ptr<id_storage> init_ids = make_default_id_storage(),
+        utils::time_source* time_source = nullptr);
     ~hlasm_context();
 
     // gets opencode file location
@@ -216,8 +240,18 @@ public:
     // field that accessed ordinary assembly context
     ordinary_assembly_context ord_ctx;
 
-    // performance metrics
-    performance_metrics metrics;
+    // performance metrics, const lookups update the cache statistics
+    mutable performance_metrics metrics;
+
+    enum class opcode_lookup_phase : unsigned char
+    {
+        open_code,
+        macro,
+        copy,
+        lookahead,
+    };
+    // processing phase the opcode cache statistics are attributed to
+    opcode_lookup_phase opcode_phase = opcode_lookup_phase::open_code;
 
     // return map of global set vars
     const global_variable_storage& globals() const;
@@ -352,6 +386,8 @@ public:
     system_variable_map get_system_variables(const code_scope&);
 
     friend variable_symbol* get_var_sym(const expressions::evaluation_context& eval_ctx, id_index name);
+    friend variable_symbol* get_var_sym(
+        const expressions::evaluation_context& eval_ctx, id_index name, variable_slot_hint& hint);
 
     bool goff() const noexcept { return asm_options_.sysopt_xobject; }
     const auto& options() const noexcept { return asm_options_; }
@@ -369,11 +405,15 @@ bool test_symbol_for_read(const variable_symbol* var,
     diagnostic_op_consumer& diags,
     std::string_view var_name);
 
-SET_t get_var_sym_value(
-    const expressions::evaluation_context& eval_ctx, id_index name, std::span<const A_t> subscript, range symbol_range);
+SET_t get_var_sym_value(const expressions::evaluation_context& eval_ctx,
+    id_index name,
+    std::span<const A_t> subscript,
+    range symbol_range,
+    variable_slot_hint* hint = nullptr);
 
 const code_scope& get_current_scope(const context::hlasm_context&);
 variable_symbol* get_var_sym(const expressions::evaluation_context& eval_ctx, id_index name);
+variable_symbol* get_var_sym(const expressions::evaluation_context& eval_ctx, id_index name, variable_slot_hint& hint);
 } // namespace hlasm_plugin::parser_library::context
 
 #endif
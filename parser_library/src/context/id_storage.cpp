@@ -31,6 +31,16 @@ size_t id_storage::size() const { return lit_.size(); }
 
 bool id_storage::empty() const { return lit_.empty(); }
 
+size_t id_storage::memory_usage() const noexcept
+{
+    // node with the string and the cached hash, bucket pointer
+    size_t result = lit_.bucket_count() * sizeof(void*) + lit_.size() * (sizeof(std::string) + 2 * sizeof(void*));
+    for (const auto& s : lit_)
+        if (s.capacity() >= sizeof(std::string)) // short strings are stored inline
+            result += s.capacity() + 1;
+    return result;
+}
+
 std::optional<id_index> id_storage::find(std::string_view value) const
 {
     if (value.size() < id_index::buffer_size)
@@ -33,6 +33,8 @@ class id_storage
 public:
     size_t size() const;
     bool empty() const;
+    // Approximate size of the stored identifiers
+    size_t memory_usage() const noexcept;
 
     std::optional<id_index> find(std::string_view val) const;
 
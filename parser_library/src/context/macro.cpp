@@ -17,6 +17,7 @@
 #include <cassert>
 #include <numeric>
 #include <stdexcept>
+#include <unordered_map>
 
 #include "copy_member.h"
 #include "variables/system_variable.h"
@@ -46,9 +47,22 @@ macro_definition::macro_definition(id_index name,
     , definition_location(std::move(definition_location))
     , used_copy_members(std::move(used_copy_members))
 {
+    // statements pulled in by COPY share the reparsed formats with the copy member and all other macros using it
+    std::unordered_map<const hlasm_statement*, statement_cache*> copied_statements;
+    for (const auto& copy : this->used_copy_members)
+    {
+        for (auto& cache : copy->cached_definition)
+            copied_statements.try_emplace(cache.get_base().get(), &cache);
+    }
+
     cached_definition.reserve(definition.size());
     for (auto&& stmt : definition)
-        cached_definition.emplace_back(std::move(stmt));
+    {
+        if (auto it = copied_statements.find(stmt.get()); it != copied_statements.end())
+            cached_definition.emplace_back(std::move(stmt), *it->second);
+        else
+            cached_definition.emplace_back(std::move(stmt));
+    }
 
     auto r = std::accumulate(params.begin(), params.end(), std::pair<size_t, size_t>(1, 0), [](auto a, const auto& e) {
         if (e.data)
@@ -96,6 +110,9 @@ std::pair<std::unique_ptr<macro_invocation>, bool> macro_definition::call(
     std::vector<macro_data_ptr> syslist;
     std::unordered_map<id_index, std::unique_ptr<macro_param_base>> named_cpy;
 
+    syslist.reserve(1 + actual_params.size());
+    named_cpy.reserve(named_params_.size() + 1);
+
     if (label_param_data)
         syslist.push_back(std::move(label_param_data));
     else
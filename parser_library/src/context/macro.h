@@ -23,6 +23,7 @@
 #include "sequence_symbol.h"
 #include "statement_cache.h"
 #include "statement_id.h"
+#include "variable_slots.h"
 #include "variables/macro_param.h"
 
 namespace hlasm_plugin::parser_library::context {
@@ -79,6 +80,8 @@ public:
     // location of the macro definition in code
     const location definition_location;
     const std::unordered_set<std::shared_ptr<copy_member>> used_copy_members;
+    // slots of variables referenced in the macro body
+    variable_slot_table variable_slots;
     // initializes macro with its name and params - positional or keyword
     macro_definition(id_index name,
         id_index label_param_name,
@@ -55,8 +55,30 @@ macro_param_data_single::macro_param_data_single(C_t value)
     , data_(std::move(value))
 {}
 
-C_t macro_param_data_composite::get_value() const { return value_; }
+namespace {
+C_t join_values(const std::vector<macro_data_ptr>& data)
+{
+    C_t result;
+    result.append("(");
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        if (i != 0)
+            result.append(",");
+        result.append(data[i]->get_value());
+    }
+    result.append(")");
+    return result;
+}
+} // namespace
 
+C_t macro_param_data_composite::get_value() const
+{
+    if (!value_)
+        value_ = join_values(data_);
+    return *value_;
+}
+
+// an empty sublist behaves as a sublist with a single empty component
 const macro_param_data_component* macro_param_data_composite::get_ith(A_t idx) const
 {
     if (0 < idx && utils::to_unsigned(idx) <= data_.size())
@@ -66,31 +88,47 @@ const macro_param_data_component* macro_param_data_composite::get_ith(A_t idx) c
 
 std::optional<std::pair<A_t, A_t>> macro_param_data_composite::index_range() const
 {
-    return std::pair<A_t, A_t>(1, (A_t)data_.size());
+    return std::pair<A_t, A_t>(1, number_of_components);
 }
 
-
 macro_param_data_composite::macro_param_data_composite(std::vector<macro_data_ptr> value)
     : macro_param_data_component(!value.empty() ? (A_t)value.size() : 1)
-    , data_(!value.empty() ? std::move(value) : [] {
-        std::vector<context::macro_data_ptr> vec;
-        vec.push_back(std::make_unique<context::macro_param_data_dummy>());
-        return vec;
-    }())
+    , data_(std::move(value))
 {
     assert(data_.size() <= std::numeric_limits<A_t>::max());
-    value_.append("(");
-    for (size_t i = 0; i < data_.size(); ++i)
-    {
-        value_.append(data_[i]->get_value());
-        if (i != data_.size() - 1)
-            value_.append(",");
-    }
-    value_.append(")");
 }
 
-C_t macro_param_data_zero_based::get_value() const { return value_; }
+const macro_param_data_component& macro_param_data_deferred::parsed() const
+{
+    if (!parsed_)
+        parsed_ = parser_(data_);
+    return *parsed_;
+}
+
+C_t macro_param_data_deferred::get_value() const { return data_; }
+
+const macro_param_data_component* macro_param_data_deferred::get_ith(A_t idx) const { return parsed().get_ith(idx); }
 
+std::optional<std::pair<A_t, A_t>> macro_param_data_deferred::index_range() const { return parsed().index_range(); }
+
+A_t macro_param_data_deferred::number() const { return parsed().number(); }
+
+bool macro_param_data_deferred::is_sublist() const { return parsed().is_sublist(); }
+
+macro_param_data_deferred::macro_param_data_deferred(C_t value, parser_t parser)
+    : macro_param_data_component(0)
+    , data_(std::move(value))
+    , parser_(parser)
+{}
+
+C_t macro_param_data_zero_based::get_value() const
+{
+    if (!value_)
+        value_ = join_values(data_);
+    return *value_;
+}
+
+// an empty list behaves as a list with a single empty component
 const macro_param_data_component* macro_param_data_zero_based::get_ith(A_t idx) const
 {
     if (0 <= idx && utils::to_unsigned(idx) < data_.size())
@@ -100,27 +138,14 @@ const macro_param_data_component* macro_param_data_zero_based::get_ith(A_t idx)
 
 std::optional<std::pair<A_t, A_t>> macro_param_data_zero_based::index_range() const
 {
-    return std::pair<A_t, A_t>(0, (A_t)data_.size() - 1);
+    return std::pair<A_t, A_t>(0, number_of_components - 1);
 }
 
-
 macro_param_data_zero_based::macro_param_data_zero_based(std::vector<macro_data_ptr> value)
     : macro_param_data_component(!value.empty() ? (A_t)value.size() : 1)
-    , data_(!value.empty() ? std::move(value) : [] {
-        std::vector<context::macro_data_ptr> vec;
-        vec.push_back(std::make_unique<context::macro_param_data_dummy>());
-        return vec;
-    }())
+    , data_(std::move(value))
 {
     assert(data_.size() <= std::numeric_limits<A_t>::max());
-    value_.append("(");
-    for (size_t i = 0; i < data_.size(); ++i)
-    {
-        value_.append(data_[i]->get_value());
-        if (i != data_.size() - 1)
-            value_.append(",");
-    }
-    value_.append(")");
 }
 
 C_t macro_param_data_single_dynamic::get_value() const { return get_dynamic_value(); }
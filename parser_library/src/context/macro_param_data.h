@@ -48,6 +48,9 @@ public:
 
     virtual A_t number() const { return number_of_components; }
 
+    // returns true when the data represent a sublist
+    virtual bool is_sublist() const { return false; }
+
 protected:
     explicit macro_param_data_component(A_t number);
 
@@ -92,7 +95,8 @@ public:
 class macro_param_data_composite final : public macro_param_data_component
 {
     const std::vector<macro_data_ptr> data_;
-    C_t value_;
+    // value is built on the first request
+    mutable std::optional<C_t> value_;
 
 public:
     // returns data of all nested classes in brackets separated by comma
@@ -103,14 +107,46 @@ public:
 
     std::optional<std::pair<A_t, A_t>> index_range() const override;
 
+    bool is_sublist() const override { return true; }
+
     explicit macro_param_data_composite(std::vector<macro_data_ptr> value);
 };
 
+// class representing sublist data of macro parameters that are split into components only when accessed
+class macro_param_data_deferred final : public macro_param_data_component
+{
+public:
+    using parser_t = macro_data_ptr (*)(C_t);
+
+private:
+    const C_t data_;
+    const parser_t parser_;
+    mutable macro_data_ptr parsed_;
+
+    const macro_param_data_component& parsed() const;
+
+public:
+    // returns the unparsed data
+    C_t get_value() const override;
+
+    // gets value of the idx-th value, when exceeds size of data, returns default value
+    const macro_param_data_component* get_ith(A_t idx) const override;
+
+    std::optional<std::pair<A_t, A_t>> index_range() const override;
+
+    A_t number() const override;
+
+    bool is_sublist() const override;
+
+    macro_param_data_deferred(C_t value, parser_t parser);
+};
+
 // class representing data of macro parameters holding SYSLIST data
 class macro_param_data_zero_based final : public macro_param_data_component
 {
     const std::vector<macro_data_ptr> data_;
-    C_t value_;
+    // value is built on the first request
+    mutable std::optional<C_t> value_;
 
 public:
     // returns data of all nested classes in brackets separated by comma
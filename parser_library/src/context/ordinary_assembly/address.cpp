@@ -94,7 +94,7 @@ void space::resolve(int length, std::vector<address::space_entry> unresolved)
     resolved_ = true;
 }
 
-std::span<const address::base_entry> address::bases() const { return bases_.bases; }
+std::span<const address::base_entry> address::bases() const { return bases_.bases(); }
 
 int get_space_offset(std::span<const address::space_entry> sp_vec)
 {
@@ -122,15 +122,19 @@ struct normalization_helper
     normalization_helper()
         : buffer_resource(buffer.data(), buffer.size())
         , map(&buffer_resource)
+        , spaces(&buffer_resource)
     {}
     alignas(std::max_align_t) std::array<unsigned char, 8 * 1024> buffer;
     std::pmr::monotonic_buffer_resource buffer_resource;
     std::pmr::unordered_map<space*, size_t> map;
+    // scratch storage for normalized spaces that do not outlive the operation
+    std::pmr::vector<address::space_entry> spaces;
 };
 
+template<typename Vector>
 int get_unresolved_spaces(std::span<const address::space_entry> spaces,
     normalization_helper& helper,
-    std::vector<address::space_entry>& normalized_spaces,
+    Vector& normalized_spaces,
     int multiplier)
 {
     int offset = 0;
@@ -151,11 +155,28 @@ int get_unresolved_spaces(std::span<const address::space_entry> spaces,
     return offset;
 }
 
-void cleanup_spaces(std::vector<address::space_entry>& spaces)
+template<typename Vector>
+void cleanup_spaces(Vector& spaces)
 {
     std::erase_if(spaces, [](const address::space_entry& e) { return e.second == 0; });
 }
 
+// normalizes spaces into the scratch storage of the helper
+std::span<const address::space_entry> normalize_spaces(
+    std::span<const address::space_entry> spaces, normalization_helper& helper)
+{
+    get_unresolved_spaces(spaces, helper, helper.spaces, 1);
+    cleanup_spaces(helper.spaces);
+    return helper.spaces;
+}
+
+address::space_list make_space_list(std::span<const address::space_entry> spaces)
+{
+    if (spaces.empty())
+        return address::space_list();
+    return address::space_list(std::make_shared<std::vector<address::space_entry>>(spaces.begin(), spaces.end()));
+}
+
 std::pair<std::vector<address::space_entry>, int> address::normalized_spaces(std::span<const space_entry> spaces)
 {
     if (spaces.empty())
@@ -177,7 +198,7 @@ std::pair<std::vector<address::space_entry>, int> address::normalized_spaces() c
 }
 
 address::address(base_entry address_base, int offset, const space_storage& spaces)
-    : bases_(std::make_shared<base_entry>(std::move(address_base)))
+    : bases_(address_base)
     , offset_(offset)
 {
     if (spaces.empty())
@@ -191,7 +212,7 @@ address::address(base_entry address_base, int offset, const space_storage& space
 }
 
 address::address(base_entry address_base, int offset, space_storage&& spaces)
-    : bases_(std::make_shared<base_entry>(std::move(address_base)))
+    : bases_(address_base)
     , offset_(offset)
 {
     if (spaces.empty())
@@ -206,12 +227,63 @@ address::address(base_entry address_base, int offset, space_storage&& spaces)
 
 constexpr auto without_cardinality = [](const address::base_entry& b) { return std::tie(b.owner, b.qualifier); };
 
+address::base_list::base_list(std::span<const base_entry> bases)
+    : m_size(bases.size())
+{
+    if (bases.size() <= inline_capacity)
+    {
+        std::ranges::copy(bases, m_inline.begin());
+        return;
+    }
+
+    auto owner = std::make_shared<base_entry[]>(bases.size());
+    std::ranges::copy(bases, owner.get());
+    m_external = owner.get();
+    m_owner = std::move(owner);
+}
+
+// merges small base lists on the stack, the result is allocated only when it does not fit the inline storage
+template<merge_op operation>
+address::base_list merge_small_bases(std::span<const address::base_entry> l, std::span<const address::base_entry> r)
+{
+    constexpr size_t max_size = 4;
+    assert(l.size() + r.size() <= max_size);
+
+    std::array<address::base_entry, max_size> buffer;
+    auto result_end = std::ranges::transform(r, buffer.begin(), [](auto e) {
+        if constexpr (operation == merge_op::sub)
+            e.cardinality = -e.cardinality;
+        return e;
+    }).out;
+
+    for (const auto& e : l)
+    {
+        const auto key = without_cardinality(e);
+        if (auto it = std::find_if(
+                buffer.begin(), result_end, [&key](const auto& b) { return without_cardinality(b) == key; });
+            it != result_end)
+            it->cardinality += e.cardinality;
+        else
+            *result_end++ = e;
+    }
+
+    result_end = std::remove_if(buffer.begin(), result_end, [](const auto& e) { return e.cardinality == 0; });
+    std::sort(buffer.begin(), result_end, [](const auto& le, const auto& re) {
+        return without_cardinality(le) < without_cardinality(re);
+    });
+
+    return address::base_list(std::span<const address::base_entry>(buffer.begin(), result_end));
+}
+
 template<merge_op operation>
 address::base_list merge_bases(const address::base_list& l, const address::base_list& r)
 {
     if (r.empty())
         return l;
 
+    const auto l_bases = l.bases();
+    const auto r_bases = r.bases();
+
     if constexpr (operation == merge_op::add)
     {
         if (l.empty())
@@ -219,34 +291,24 @@ address::base_list merge_bases(const address::base_list& l, const address::base_
     }
     else
     {
-        if (l.empty())
-        {
-            const auto total = std::ranges::size(r.bases);
-            auto result_owner = std::make_shared<address::base_entry[]>(total);
-            std::span result(result_owner.get(), total);
-
-            std::ranges::transform(r.bases, result.begin(), [](auto e) {
-                e.cardinality *= -1;
-                return e;
-            });
-
-            return address::base_list(result, std::move(result_owner));
-        }
-        if (std::ranges::equal(l.bases, r.bases))
+        if (std::ranges::equal(l_bases, r_bases))
             return {};
     }
 
+    if (l_bases.size() + r_bases.size() <= 4)
+        return merge_small_bases<operation>(l_bases, r_bases);
+
     auto result = std::make_shared<std::vector<address::base_entry>>();
 
-    result->reserve(l.bases.size() + r.bases.size());
+    result->reserve(l_bases.size() + r_bases.size());
 
-    for (const auto& [qual, owner, cnt] : r.bases)
+    for (const auto& [qual, owner, cnt] : r_bases)
         result->emplace_back(qual, owner, operation == merge_op::add ? cnt : -cnt);
 
     std::ranges::sort(*result, {}, without_cardinality);
     utils::merge_unsorted(
         *result,
-        l.bases,
+        l_bases,
         [](const auto& le, const auto& re) { return without_cardinality(le) <=> without_cardinality(re); },
         [](auto& re, const auto& e) { re.cardinality += e.cardinality; });
 
@@ -260,18 +322,17 @@ address address::operator+(const address& addr) const
     if (!has_spaces() && !addr.has_spaces())
         return address(merge_bases<merge_op::add>(bases_, addr.bases_), offset_ + addr.offset_, space_list());
 
-    auto res_spaces = std::make_shared<std::vector<space_entry>>();
     normalization_helper helper;
+    auto& res_spaces = helper.spaces;
 
     int offset = 0;
-    offset += get_unresolved_spaces(spaces_.spaces, helper, *res_spaces, 1);
-    offset += get_unresolved_spaces(addr.spaces_.spaces, helper, *res_spaces, 1);
+    offset += get_unresolved_spaces(spaces_.spaces, helper, res_spaces, 1);
+    offset += get_unresolved_spaces(addr.spaces_.spaces, helper, res_spaces, 1);
 
-    cleanup_spaces(*res_spaces);
+    cleanup_spaces(res_spaces);
 
-    return address(merge_bases<merge_op::add>(bases_, addr.bases_),
-        offset_ + addr.offset_ + offset,
-        space_list(std::move(res_spaces)));
+    return address(
+        merge_bases<merge_op::add>(bases_, addr.bases_), offset_ + addr.offset_ + offset, make_space_list(res_spaces));
 }
 
 address address::operator+(int offs) const { return address(bases_, offset_ + offs, spaces_); }
@@ -314,58 +375,49 @@ address address::operator-(const address& addr) const
                 space_list(lspaces, spaces_.owner));
     }
 
-    auto res_spaces = std::make_shared<std::vector<space_entry>>();
+    auto& res_spaces = helper.spaces;
 
     if (auto processed = lspaces.subspan(0, l_processed); !processed.empty())
     {
-        res_spaces->insert(res_spaces->end(), processed.begin(), processed.end());
+        res_spaces.insert(res_spaces.end(), processed.begin(), processed.end());
         lspaces = lspaces.subspan(l_processed);
     }
 
     int offset = 0;
-    offset += get_unresolved_spaces(lspaces, helper, *res_spaces, 1);
-    offset += get_unresolved_spaces(rspaces, helper, *res_spaces, -1);
+    offset += get_unresolved_spaces(lspaces, helper, res_spaces, 1);
+    offset += get_unresolved_spaces(rspaces, helper, res_spaces, -1);
 
-    cleanup_spaces(*res_spaces);
+    cleanup_spaces(res_spaces);
 
-    return address(merge_bases<merge_op::sub>(bases_, addr.bases_),
-        offset_ - addr.offset_ + offset,
-        space_list(std::move(res_spaces)));
+    return address(
+        merge_bases<merge_op::sub>(bases_, addr.bases_), offset_ - addr.offset_ + offset, make_space_list(res_spaces));
 }
 
 address address::operator-(int offs) const { return address(bases_, offset_ - offs, spaces_); }
 
 address address::operator-() const
 {
-    auto [spaces, off] = normalized_spaces();
-    const auto total = std::ranges::size(bases_.bases);
-    auto inv_bases_owner = std::make_shared<address::base_entry[]>(total);
-    std::span inv_bases(inv_bases_owner.get(), total);
-
-    std::ranges::transform(bases_.bases, inv_bases.begin(), [](auto b) {
-        b.cardinality = -b.cardinality;
-        return b;
-    });
+    normalization_helper helper;
+    const int off = get_unresolved_spaces(spaces_.spaces, helper, helper.spaces, -1);
+    cleanup_spaces(helper.spaces);
 
-    for (auto& s : spaces)
-        s.second = -s.second;
-    return address(address::base_list(inv_bases, std::move(inv_bases_owner)),
-        -offset_ - off,
-        space_list(std::make_shared<std::vector<space_entry>>(std::move(spaces))));
+    return address(merge_bases<merge_op::sub>(base_list(), bases_), -offset_ + off, make_space_list(helper.spaces));
 }
 
-bool address::is_complex() const { return bases_.bases.size() > 1; }
+bool address::is_complex() const { return bases_.bases().size() > 1; }
 
 bool address::in_same_loctr(const address& addr) const
 {
     if (!is_simple() || !addr.is_simple())
         return false;
 
-    if (without_cardinality(addr.bases_.bases[0]) != without_cardinality(bases_.bases[0]))
+    if (without_cardinality(addr.bases_.bases()[0]) != without_cardinality(bases_.bases()[0]))
         return false;
 
-    auto [spaces, _] = normalized_spaces();
-    auto [addr_spaces, __] = addr.normalized_spaces();
+    normalization_helper helper;
+    normalization_helper addr_helper;
+    const auto spaces = normalize_spaces(spaces_.spaces, helper);
+    const auto addr_spaces = normalize_spaces(addr.spaces_.spaces, addr_helper);
 
     bool this_has_loctr_begin = spaces.size() && spaces[0].first->kind == space_kind::LOCTR_BEGIN;
     bool addr_has_loctr_begin = addr_spaces.size() && addr_spaces[0].first->kind == space_kind::LOCTR_BEGIN;
@@ -382,13 +434,14 @@ bool address::in_same_loctr(const address& addr) const
     }
 }
 
-bool address::is_simple() const { return bases_.bases.size() == 1 && bases_.bases[0].cardinality == 1; }
+bool address::is_simple() const { return bases_.bases().size() == 1 && bases_.bases()[0].cardinality == 1; }
 
 bool address::has_dependant_space() const
 {
     if (!has_spaces() || (spaces_.spaces.size() == 1 && spaces_.spaces.front().first->kind == space_kind::LOCTR_BEGIN))
         return false;
-    auto [spaces, _] = normalized_spaces();
+    normalization_helper helper;
+    const auto spaces = normalize_spaces(spaces_.spaces, helper);
     if (spaces.empty() || (spaces.size() == 1 && spaces.front().first->kind == space_kind::LOCTR_BEGIN))
         return false;
     return true;
@@ -399,9 +452,9 @@ bool address::has_unresolved_space() const
     if (!has_spaces())
         return false;
 
-    auto [spaces, _] = normalized_spaces();
+    normalization_helper helper;
 
-    return !spaces.empty();
+    return !normalize_spaces(spaces_.spaces, helper).empty();
 }
 
 bool address::has_spaces() const { return !spaces_.empty(); }
@@ -421,11 +474,10 @@ address address::normalized() const
     if (!has_spaces())
         return *this;
 
-    auto [spaces, off] = normalized_spaces();
-
-    if (spaces.empty())
-        return address(bases_, offset_ + off, space_list());
+    normalization_helper helper;
+    const int off = get_unresolved_spaces(spaces_.spaces, helper, helper.spaces, 1);
+    cleanup_spaces(helper.spaces);
 
-    return address(bases_, offset_ + off, space_list(std::make_shared<std::vector<space_entry>>(std::move(spaces))));
+    return address(bases_, offset_ + off, make_space_list(helper.spaces));
 }
 } // namespace hlasm_plugin::parser_library::context
@@ -15,6 +15,7 @@
 #ifndef CONTEXT_ADDRESS_H
 #define CONTEXT_ADDRESS_H
 
+#include <array>
 #include <compare>
 #include <memory>
 #include <span>
@@ -68,27 +69,39 @@ struct address
         bool empty() const { return spaces.empty(); }
     };
 
-    struct base_list
+    // list of bases, up to inline_capacity entries are stored without allocation
+    class base_list
     {
+        static constexpr size_t inline_capacity = 2;
+
+        std::shared_ptr<const void> m_owner;
+        const base_entry* m_external = nullptr;
+        size_t m_size = 0;
+        std::array<base_entry, inline_capacity> m_inline = {};
+
+    public:
         base_list() = default;
         template<typename T>
         explicit base_list(std::shared_ptr<T> ptr) requires(!std::same_as<T, base_entry>)
-            : bases(*ptr)
-            , owner(std::move(ptr))
+            : base_list(std::span<const base_entry>(*ptr), std::move(ptr))
         {}
-        explicit base_list(std::shared_ptr<const base_entry> ptr)
-            : bases(std::span(ptr.get(), !!ptr.get()))
-            , owner(std::move(ptr))
+        explicit base_list(const base_entry& base)
+            : m_size(1)
+            , m_inline { base }
         {}
+        explicit base_list(std::span<const base_entry> bases);
         explicit base_list(std::span<const base_entry> bases, std::shared_ptr<const void> owner)
-            : bases(bases)
-            , owner(std::move(owner))
+            : m_owner(std::move(owner))
+            , m_external(bases.data())
+            , m_size(bases.size())
         {}
 
-        std::span<const base_entry> bases;
-        std::shared_ptr<const void> owner;
+        std::span<const base_entry> bases() const noexcept
+        {
+            return std::span(m_external ? m_external : m_inline.data(), m_size);
+        }
 
-        bool empty() const { return bases.empty(); }
+        bool empty() const { return m_size == 0; }
     };
 
 private:
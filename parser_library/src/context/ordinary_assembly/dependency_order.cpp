@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "dependency_order.h"
+
+#include <algorithm>
+
+namespace hlasm_plugin::parser_library::context {
+
+dependency_order::node* dependency_order::get(dependant_ref key, bool& inserted)
+{
+    auto [it, ins] = m_nodes.try_emplace(key);
+    if (ins)
+        it->second.key = key;
+    inserted = ins;
+    return &it->second;
+}
+
+bool dependency_order::add(dependant_ref target, std::span<const dependant_ref> dependencies)
+{
+    if (!m_valid)
+        return false;
+    if (dependencies.empty())
+        return true;
+
+    bool target_inserted;
+    node* const t = get(target, target_inserted);
+    if (target_inserted)
+        t->order = --m_min_order; // nothing depends on the target yet
+    const auto recorded = t->out.size();
+
+    for (const auto& d : dependencies)
+    {
+        bool inserted;
+        node* const n = get(d, inserted);
+        // nodes without dependencies can be moved behind everything else
+        if (inserted || (n->out.empty() && n != t && n->order < t->order))
+            n->order = ++m_max_order;
+
+        if (n == t || !add_edge(t, n))
+        {
+            rollback(t, recorded, target_inserted);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool dependency_order::add_edge(node* from, node* to)
+{
+    if (std::ranges::find(from->out, to) != from->out.end())
+        return true;
+
+    if (from->order > to->order)
+    {
+        // only the nodes between the two positions are affected
+        const auto lower_bound = to->order;
+        const auto upper_bound = from->order;
+
+        std::vector<node*> forward;
+        std::vector<node*> backward;
+        std::vector<node*> stack;
+
+        ++m_mark;
+
+        to->mark = m_mark;
+        stack.push_back(to);
+        while (!stack.empty())
+        {
+            node* const n = stack.back();
+            stack.pop_back();
+            forward.push_back(n);
+            for (node* s : n->out)
+            {
+                if (s == from)
+                    return false;
+                if (s->mark == m_mark || s->order > upper_bound)
+                    continue;
+                s->mark = m_mark;
+                stack.push_back(s);
+            }
+        }
+
+        from->mark = m_mark;
+        stack.push_back(from);
+        while (!stack.empty())
+        {
+            node* const n = stack.back();
+            stack.pop_back();
+            backward.push_back(n);
+            for (node* p : n->in)
+            {
+                if (p->mark == m_mark || p->order < lower_bound)
+                    continue;
+                p->mark = m_mark;
+                stack.push_back(p);
+            }
+        }
+
+        constexpr auto by_order = [](const node* l, const node* r) { return l->order < r->order; };
+        std::ranges::sort(forward, by_order);
+        std::ranges::sort(backward, by_order);
+
+        std::vector<int64_t> orders;
+        orders.reserve(forward.size() + backward.size());
+        for (const auto* n : backward)
+            orders.push_back(n->order);
+        for (const auto* n : forward)
+            orders.push_back(n->order);
+        std::ranges::sort(orders);
+
+        auto order = orders.begin();
+        for (auto* n : backward)
+            n->order = *order++;
+        for (auto* n : forward)
+            n->order = *order++;
+    }
+
+    from->out.push_back(to);
+    to->in.push_back(from);
+
+    return true;
+}
+
+void dependency_order::rollback(node* t, size_t recorded, bool target_inserted)
+{
+    // new dependencies have no other edges than the ones just added
+    for (auto* s : std::span(t->out).subspan(recorded))
+    {
+        std::erase(s->in, t);
+        if (s->in.empty() && s->out.empty())
+            m_nodes.erase(s->key);
+    }
+    t->out.resize(recorded);
+
+    if (target_inserted || (t->in.empty() && t->out.empty()))
+        m_nodes.erase(t->key);
+}
+
+void dependency_order::detach(node* n)
+{
+    for (auto* s : n->out)
+    {
+        std::erase(s->in, n);
+        if (s->in.empty() && s->out.empty())
+            m_nodes.erase(s->key);
+    }
+    for (auto* p : n->in)
+    {
+        std::erase(p->out, n);
+        if (p->in.empty() && p->out.empty())
+            m_nodes.erase(p->key);
+    }
+}
+
+void dependency_order::remove(dependant_ref target)
+{
+    const auto it = m_nodes.find(target);
+    if (it == m_nodes.end())
+        return;
+
+    detach(&it->second);
+    m_nodes.erase(it);
+}
+
+bool dependency_order::contains(dependant_ref from, dependant_ref to) const
+{
+    const auto f = m_nodes.find(from);
+    const auto t = m_nodes.find(to);
+    if (f == m_nodes.end() || t == m_nodes.end())
+        return false;
+
+    return std::ranges::find(f->second.out, &t->second) != f->second.out.end();
+}
+
+void dependency_order::clear()
+{
+    m_nodes.clear();
+    m_min_order = 0;
+    m_max_order = 0;
+    m_valid = true;
+}
+
+} // namespace hlasm_plugin::parser_library::context
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef CONTEXT_DEPENDENCY_ORDER_H
+#define CONTEXT_DEPENDENCY_ORDER_H
+
+#include <cstdint>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "dependant.h"
+
+namespace hlasm_plugin::parser_library::context {
+
+// Incrementally maintained topological order of symbolic dependencies (Pearce-Kelly).
+// Edges lead from a dependant to the symbols and attributes it may depend on. Adding edges only reorders the region
+// between the affected nodes, so the absence of a cycle is usually proven without traversing the dependency chains.
+class dependency_order
+{
+    struct node
+    {
+        dependant_ref key;
+        int64_t order = 0;
+        size_t mark = 0;
+        std::vector<node*> out;
+        std::vector<node*> in;
+    };
+
+    std::unordered_map<dependant_ref, node> m_nodes;
+    int64_t m_min_order = 0;
+    int64_t m_max_order = 0;
+    size_t m_mark = 0;
+    bool m_valid = true;
+
+    node* get(dependant_ref key, bool& inserted);
+    bool add_edge(node* from, node* to);
+    // Removes the edges of the target added after the first recorded ones together with the nodes left without edges
+    void rollback(node* t, size_t recorded, bool target_inserted);
+    void detach(node* n);
+
+public:
+    // Adds edges from the target to its dependencies.
+    // Returns false when the order cannot prove that the edges do not close a cycle, the edges are not recorded then.
+    bool add(dependant_ref target, std::span<const dependant_ref> dependencies);
+
+    // Removes the node with all its edges
+    void remove(dependant_ref target);
+
+    bool contains(dependant_ref from, dependant_ref to) const;
+
+    size_t size() const noexcept { return m_nodes.size(); }
+
+    // Dependencies were added without being recorded, the order cannot be used until cleared
+    void invalidate() noexcept { m_valid = false; }
+    bool valid() const noexcept { return m_valid; }
+
+    void clear();
+};
+
+} // namespace hlasm_plugin::parser_library::context
+
+#endif
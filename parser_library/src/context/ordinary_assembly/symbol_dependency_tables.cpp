@@ -32,6 +32,52 @@
 #include "utils/projectors.h"
 
 namespace hlasm_plugin::parser_library::context {
+namespace {
+dependant_ref to_dependant_ref(const dependant& d)
+{
+    if (std::holds_alternative<id_index>(d))
+        return std::get<id_index>(d);
+    if (std::holds_alternative<attr_ref>(d))
+        return std::get<attr_ref>(d);
+    return std::get<space_ptr>(d).get();
+}
+
+// only symbols and their length and scale attributes can be dependants themselves
+void append_symbolic_dependencies(std::vector<dependant_ref>& result, const symbolic_reference& ref)
+{
+    if (ref.get())
+        result.emplace_back(ref.name);
+    for (auto attr : { data_attr_kind::L, data_attr_kind::S })
+        if (ref.get(attr))
+            result.emplace_back(attr_ref { attr, ref.name });
+}
+} // namespace
+
+bool symbol_dependency_tables::creates_cycle(const dependant& target,
+    const resolvable* dependency_source,
+    const dependency_evaluation_context& dep_ctx,
+    const library_info& li)
+{
+    // Symbols and attributes never become undefined again, so dependencies of a statement can only shrink
+    // until all symbols are known and spaces take over. Cycles through spaces are still searched for.
+    std::vector<dependant_ref> symbolic_deps;
+    {
+        context::ordinary_assembly_dependency_solver dep_solver(m_sym_ctx, dep_ctx, li);
+        for (const auto& ref : dependency_source->get_dependencies(dep_solver).undefined_symbolics)
+            append_symbolic_dependencies(symbolic_deps, ref);
+    }
+
+    const bool ordered = m_dependency_order.add(to_dependant_ref(target), symbolic_deps);
+    if (ordered && m_pending_spaces == 0)
+        return false;
+
+    const bool cycle = has_cycle(target, extract_dependencies(dependency_source, dep_ctx, li), li);
+    if (!cycle && !ordered)
+        m_dependency_order.invalidate();
+
+    return cycle;
+}
+
 bool symbol_dependency_tables::has_cycle(dependant target, std::vector<dependant> dependencies, const library_info& li)
 {
     if (dependencies.empty())
@@ -43,22 +89,12 @@ bool symbol_dependency_tables::has_cycle(dependant target, std::vector<dependant
         return true;
     }
 
-    const auto dep_to_depref = [](const dependant& d) -> dependant_ref {
-        if (std::holds_alternative<id_index>(d))
-            return std::get<id_index>(d);
-        if (std::holds_alternative<attr_ref>(d))
-            return std::get<attr_ref>(d);
-        if (std::holds_alternative<space_ptr>(d))
-            return std::get<space_ptr>(d).get();
-        assert(false);
-    };
-
     alignas(std::max_align_t) std::array<unsigned char, 8 * 1024> buffer;
     std::pmr::monotonic_buffer_resource buffer_resource(buffer.data(), buffer.size());
     std::pmr::unordered_set<dependant_ref> seen_before(&buffer_resource);
 
     for (const auto& d : dependencies)
-        seen_before.emplace(dep_to_depref(d));
+        seen_before.emplace(to_dependant_ref(d));
 
     while (!dependencies.empty())
     {
@@ -76,7 +112,7 @@ bool symbol_dependency_tables::has_cycle(dependant target, std::vector<dependant
                 resolve_dependant_default(target);
                 return true;
             }
-            if (!seen_before.emplace(dep_to_depref(dep)).second)
+            if (!seen_before.emplace(to_dependant_ref(dep)).second)
                 continue;
             dependencies.emplace_back(std::move(dep));
         }
@@ -277,197 +313,107 @@ struct resolve_dependant_default_visitor
 
 void symbol_dependency_tables::resolve_dependant_default(const dependant& target)
 {
-    m_dependencies_filters.reset_global(std::visit(dependant_hasher, target));
+    m_dependency_order.remove(to_dependant_ref(target));
+    wake_dependants(std::visit(dependant_hasher, target));
     std::visit(resolve_dependant_default_visitor { m_sym_ctx }, target);
 }
 
-class symbol_dependency_tables::dep_value
-{
-public:
-    // this type only exists to satisfy BiDirIt/RAIt requirements
-    // The functions below are intentionally not implemented
-    explicit(false) dep_value(dep_reference ref) noexcept;
-    dep_value& operator=(dep_reference ref) noexcept;
-};
-
-class symbol_dependency_tables::dep_reference
+void symbol_dependency_tables::add_waiting_dependant(size_t what, const dependant& target)
 {
-    size_t idx;
-    symbol_dependency_tables& self;
-
-    friend void swap(symbol_dependency_tables::dep_reference l, symbol_dependency_tables::dep_reference r) noexcept
-    {
-        assert(&l.self == &r.self);
-        if (l.idx == r.idx)
-            return;
-
-        auto& self = l.self;
-
-        using std::swap;
-        swap(self.m_dependencies_iterators[l.idx]->second.m_last_dependencies,
-            self.m_dependencies_iterators[r.idx]->second.m_last_dependencies);
-        swap(self.m_dependencies_iterators[l.idx], self.m_dependencies_iterators[r.idx]);
-        swap(self.m_dependencies_attributes[l.idx], self.m_dependencies_attributes[r.idx]);
-        self.m_dependencies_filters.swap(l.idx, r.idx);
-    }
-
-public:
-    constexpr dep_reference(size_t idx, symbol_dependency_tables& self) noexcept
-        : idx(idx)
-        , self(self)
-    {}
-
-    auto iterator() const noexcept { return self.m_dependencies_iterators[idx]; }
-    bool any_attr() const noexcept
-    {
-        const auto v = self.m_dependencies_attributes[idx];
-        return v.has_t_attr | v.space_ptr_type | v.delay_eval;
-    }
-    bool any() const noexcept { return self.m_dependencies_filters.any(idx); }
-
-    dep_reference(const dep_reference&) noexcept = default;
-    dep_reference(dep_reference&&) noexcept = default;
-
-    dep_reference& operator=(const dep_reference& o) noexcept = delete;
-    dep_reference& operator=(dep_reference&& o) noexcept = delete;
-
-    ~dep_reference() noexcept = default;
-};
+    if (auto& waiting = m_waiting_dependants[what]; waiting.empty() || waiting.back() != target)
+        waiting.push_back(target);
+}
 
-class symbol_dependency_tables::dep_iterator
+void symbol_dependency_tables::wake_dependants(size_t what)
 {
-    size_t idx;
-    symbol_dependency_tables* self;
+    const auto it = m_waiting_dependants.find(what);
+    if (it == m_waiting_dependants.end())
+        return;
 
-public:
-    using difference_type = std::ptrdiff_t;
-    using value_type = dep_value;
-    using pointer = dep_iterator;
-    using reference = dep_reference;
-    using iterator_category = std::random_access_iterator_tag;
+    auto waiting = std::move(it->second);
+    m_waiting_dependants.erase(it);
 
-    constexpr dep_iterator() noexcept
-        : idx(0)
-        , self(nullptr)
-    {}
-    constexpr dep_iterator(size_t idx, symbol_dependency_tables* self) noexcept
-        : idx(idx)
-        , self(self)
-    {}
-
-    dep_iterator& operator++() noexcept
-    {
-        ++idx;
-        return *this;
-    }
-    dep_iterator& operator--() noexcept
-    {
-        --idx;
-        return *this;
-    }
-    dep_iterator operator++(int) noexcept
-    {
-        auto me = *this;
-        ++idx;
-        return me;
-    }
-    dep_iterator operator--(int) noexcept
+    for (auto& target : waiting)
     {
-        auto me = *this;
-        --idx;
-        return me;
-    }
-
-    dep_reference operator*() const noexcept { return { idx, *self }; }
-    dep_reference operator[](difference_type offset) const noexcept { return { idx + (size_t)offset, *self }; }
-
-    friend dep_iterator operator+(difference_type offset, dep_iterator it) noexcept { return it + offset; }
-
-    dep_iterator operator+(difference_type offset) const noexcept { return { idx + (size_t)offset, self }; }
-    dep_iterator operator-(difference_type offset) const noexcept { return { idx - (size_t)offset, self }; }
-
-    dep_iterator& operator+=(difference_type offset) noexcept
-    {
-        idx += (size_t)offset;
-        return *this;
-    }
-    dep_iterator& operator-=(difference_type offset) noexcept
-    {
-        idx -= (size_t)offset;
-        return *this;
-    }
+        const auto dep_it = m_dependencies.find(target);
+        if (dep_it == m_dependencies.end())
+            continue;
 
-    difference_type operator-(const dep_iterator& o) const noexcept
-    {
-        assert(self == o.self);
-        return utils::to_signed(idx - o.idx);
-    }
+        const auto idx = dep_it->second.m_last_dependencies;
+        if (!m_dependencies_filters.any(idx))
+            continue; // already scheduled
 
-    bool operator==(const dep_iterator& o) const noexcept
-    {
-        assert(self == o.self);
-        return idx == o.idx;
-    }
-    auto operator<=>(const dep_iterator& o) const noexcept
-    {
-        assert(self == o.self);
-        return idx <=> o.idx;
+        m_dependencies_filters.reset(what, idx);
+        if (!m_dependencies_filters.any(idx))
+            m_ready_dependants.push_back(std::move(target));
     }
-};
-
-symbol_dependency_tables::dep_iterator symbol_dependency_tables::dependency_iterator(size_t idx)
-{
-    static_assert(std::random_access_iterator<dep_iterator>);
-    return dep_iterator { idx, this };
-}
-
-symbol_dependency_tables::dep_iterator symbol_dependency_tables::dep_begin() { return dependency_iterator(0); }
-symbol_dependency_tables::dep_iterator symbol_dependency_tables::dep_end()
-{
-    return dependency_iterator(m_dependencies_iterators.size());
 }
 
 void symbol_dependency_tables::resolve_loop(diagnostic_consumer* diags, const library_info& li)
 {
-    const auto has_dependency = [this, &li](auto dref) {
-        return dref.any() || update_dependencies(dref.iterator()->second, li);
-    };
+    if (diags)
+    {
+        m_ready_dependants.insert(m_ready_dependants.end(),
+            std::make_move_iterator(m_deferred_dependants.begin()),
+            std::make_move_iterator(m_deferred_dependants.end()));
+        m_deferred_dependants.clear();
+    }
 
-    const auto db = dep_begin();
-    auto e = dep_end();
-    const auto b = diags
-        ? db
-        : std::partition(dependency_iterator(m_dependencies_skip_index), e, [](auto dref) { return dref.any_attr(); });
-    m_dependencies_skip_index = utils::to_unsigned(b - db);
+    // dependants waiting only for the type attribute are re-evaluated as long as something gets resolved
+    std::vector<dependant> retry;
+    bool progress = false;
 
     while (true)
     {
-        e = dep_end();
+        if (m_ready_dependants.empty())
+        {
+            if (!progress || retry.empty())
+                break;
+            m_ready_dependants.swap(retry);
+            progress = false;
+        }
+
+        auto target = std::move(m_ready_dependants.back());
+        m_ready_dependants.pop_back();
 
-        const auto it = std::partition(b, e, has_dependency);
-        if (it == e)
-            break;
+        const auto dep_it = m_dependencies.find(target);
+        if (dep_it == m_dependencies.end())
+            continue;
+
+        const auto idx = dep_it->second.m_last_dependencies;
+        if (m_dependencies_filters.any(idx))
+            continue;
 
-        auto accum = m_dependencies_filters.get_global_reset_accumulator();
-        while (it != e)
+        if (const auto attr = m_dependencies_attributes[idx];
+            !diags && (attr.has_t_attr || attr.space_ptr_type || attr.delay_eval))
         {
-            --e;
-            const auto dep_it = (*e).iterator();
-            const auto& [target, dep_value] = *dep_it;
+            m_deferred_dependants.push_back(std::move(target));
+            continue;
+        }
 
-            resolve_dependant(target, dep_value.m_resolvable, diags, dep_value.m_dec, li); // resolve target
-            if (auto id = dep_it->second.related_statement_id)
-            {
-                auto& ref_count = m_postponed_stmts_references[id.value()];
-                assert(ref_count >= 1);
-                --ref_count;
-            }
+        if (update_dependencies(dep_it->first, dep_it->second, li))
+        {
+            if (!m_dependencies_filters.any(idx))
+                (diags ? retry : m_deferred_dependants).push_back(std::move(target));
+            continue;
+        }
 
-            accum.reset(std::visit(dependant_hasher, target));
-            delete_dependency(dep_it);
+        const auto& dep_value = dep_it->second;
+        resolve_dependant(target, dep_value.m_resolvable, diags, dep_value.m_dec, li); // resolve target
+        if (auto id = dep_it->second.related_statement_id)
+        {
+            auto& ref_count = m_postponed_stmts_references[id.value()];
+            assert(ref_count >= 1);
+            --ref_count;
         }
-        m_dependencies_filters.reset_global(accum);
+
+        delete_dependency(dep_it);
+        wake_dependants(std::visit(dependant_hasher, target));
+        progress = true;
     }
+
+    m_deferred_dependants.insert(
+        m_deferred_dependants.end(), std::make_move_iterator(retry.begin()), std::make_move_iterator(retry.end()));
 }
 
 const symbol_dependency_tables::dependency_value* symbol_dependency_tables::find_dependency_value(
@@ -525,7 +471,8 @@ std::vector<dependant> symbol_dependency_tables::extract_dependencies(
     return ret;
 }
 
-bool symbol_dependency_tables::update_dependencies(const dependency_value& d, const library_info& li)
+bool symbol_dependency_tables::update_dependencies(
+    const dependant& target, const dependency_value& d, const library_info& li)
 {
     context::ordinary_assembly_dependency_solver dep_solver(m_sym_ctx, d.m_dec, li);
     auto deps = d.m_resolvable->get_dependencies(dep_solver);
@@ -533,6 +480,18 @@ bool symbol_dependency_tables::update_dependencies(const dependency_value& d, co
     m_dependencies_filters.reset(d.m_last_dependencies);
     m_dependencies_attributes[d.m_last_dependencies].has_t_attr = false;
 
+    if (m_dependency_order.valid() && !std::holds_alternative<space_ptr>(target))
+    {
+        std::vector<dependant_ref> symbolic_deps;
+        for (const auto& ref : deps.undefined_symbolics)
+            append_symbolic_dependencies(symbolic_deps, ref);
+        const auto recorded = [this, target_ref = to_dependant_ref(target)](const auto& dep) {
+            return m_dependency_order.contains(target_ref, dep);
+        };
+        if (!std::ranges::all_of(symbolic_deps, recorded))
+            m_dependency_order.invalidate();
+    }
+
     for (const auto& ref : deps.undefined_symbolics)
     {
         if (ref.get(context::data_attr_kind::T))
@@ -541,7 +500,9 @@ bool symbol_dependency_tables::update_dependencies(const dependency_value& d, co
         if (ref.has_only(context::data_attr_kind::T))
             continue;
 
-        m_dependencies_filters.set(dependant_hasher(ref.name), d.m_last_dependencies);
+        const auto what = dependant_hasher(ref.name);
+        m_dependencies_filters.set(what, d.m_last_dependencies);
+        add_waiting_dependant(what, target);
     }
 
     if (m_dependencies_filters.any(d.m_last_dependencies)
@@ -561,14 +522,18 @@ bool symbol_dependency_tables::update_dependencies(const dependency_value& d, co
             continue;
         if (e->resolved())
             continue;
-        m_dependencies_filters.set(dependant_hasher(e), d.m_last_dependencies);
+        const auto what = dependant_hasher(e);
+        m_dependencies_filters.set(what, d.m_last_dependencies);
+        add_waiting_dependant(what, target);
     }
 
     for (const auto& [sp, _] : addr_spaces)
     {
         if (loctr_cnt && !unknown_loctr(sp))
             continue;
-        m_dependencies_filters.set(dependant_hasher(sp), d.m_last_dependencies);
+        const auto what = dependant_hasher(sp);
+        m_dependencies_filters.set(what, d.m_last_dependencies);
+        add_waiting_dependant(what, target);
     }
 
     return m_dependencies_filters.any(d.m_last_dependencies);
@@ -616,10 +581,8 @@ symbol_dependency_tables::dependency_value* symbol_dependency_tables::add_depend
     const library_info& li,
     delay_eval_t delay_eval)
 {
-    if (has_cycle(target, extract_dependencies(dependency_source, dep_ctx, li), li))
+    if (creates_cycle(target, dependency_source, dep_ctx, li))
     {
-        m_dependencies_filters.reset_global(dependant_hasher(target));
-
         resolve_loop(nullptr, li);
         return nullptr;
     }
@@ -633,10 +596,8 @@ symbol_dependency_tables::dependency_value* symbol_dependency_tables::add_depend
     const library_info& li,
     delay_eval_t delay_eval)
 {
-    if (has_cycle(target, extract_dependencies(dependency_source, dep_ctx, li), li))
+    if (creates_cycle(target, dependency_source, dep_ctx, li))
     {
-        m_dependencies_filters.reset_global(dependant_hasher(target));
-
         resolve_loop(nullptr, li);
         return nullptr;
     }
@@ -662,16 +623,18 @@ symbol_dependency_tables::dependency_value& symbol_dependency_tables::insert_dep
 
     assert(inserted);
 
+    m_ready_dependants.push_back(it->first);
+    m_pending_spaces += is_space_ptr;
+
     return it->second;
 }
 
 void symbol_dependency_tables::delete_dependency(std::unordered_map<dependant, dependency_value>::iterator it)
 {
-    const auto me_idx = it->second.m_last_dependencies;
-
-    m_dependencies_skip_index = std::min(m_dependencies_skip_index, me_idx);
+    swap_dependencies(it->second.m_last_dependencies, m_dependencies_iterators.size() - 1);
 
-    swap(dep_reference { me_idx, *this }, dep_reference { m_dependencies_iterators.size() - 1, *this });
+    m_pending_spaces -= std::holds_alternative<space_ptr>(it->first);
+    m_dependency_order.remove(to_dependant_ref(it->first));
 
     m_dependencies_iterators.pop_back();
     m_dependencies_attributes.pop_back();
@@ -680,6 +643,19 @@ void symbol_dependency_tables::delete_dependency(std::unordered_map<dependant, d
     m_dependencies.erase(it);
 }
 
+void symbol_dependency_tables::swap_dependencies(size_t l, size_t r) noexcept
+{
+    if (l == r)
+        return;
+
+    using std::swap;
+    swap(m_dependencies_iterators[l]->second.m_last_dependencies,
+        m_dependencies_iterators[r]->second.m_last_dependencies);
+    swap(m_dependencies_iterators[l], m_dependencies_iterators[r]);
+    swap(m_dependencies_attributes[l], m_dependencies_attributes[r]);
+    m_dependencies_filters.swap(l, r);
+}
+
 void symbol_dependency_tables::add_dependency(space_ptr target,
     addr_res_ptr dependency_source,
     const dependency_evaluation_context& dep_ctx,
@@ -718,12 +694,12 @@ void symbol_dependency_tables::all_defined(diagnostic_consumer* diag_consumer, c
 
 void symbol_dependency_tables::add_defined(id_index what_changed)
 {
-    m_dependencies_filters.reset_global(dependant_hasher(what_changed));
+    wake_dependants(dependant_hasher(what_changed));
 }
 
 void symbol_dependency_tables::add_defined(id_index what_changed, const library_info& li)
 {
-    m_dependencies_filters.reset_global(dependant_hasher(what_changed));
+    wake_dependants(dependant_hasher(what_changed));
 
     resolve_loop(nullptr, li);
 }
@@ -731,7 +707,7 @@ void symbol_dependency_tables::add_defined(id_index what_changed, const library_
 void symbol_dependency_tables::add_defined(
     space_ptr what_changed, diagnostic_consumer* diag_consumer, const library_info& li)
 {
-    m_dependencies_filters.reset_global(dependant_hasher(what_changed));
+    wake_dependants(dependant_hasher(what_changed));
 
     resolve_loop(diag_consumer, li);
 }
@@ -830,6 +806,11 @@ postponed_statements_t symbol_dependency_tables::collect_postponed()
     m_dependencies_iterators.clear();
     m_dependencies_filters.clear();
     m_dependencies_attributes.clear();
+    m_waiting_dependants.clear();
+    m_ready_dependants.clear();
+    m_deferred_dependants.clear();
+    m_dependency_order.clear();
+    m_pending_spaces = 0;
 
     return result;
 }
@@ -26,6 +26,7 @@
 #include "context/opcode_generation.h"
 #include "dependable.h"
 #include "dependant.h"
+#include "dependency_order.h"
 #include "diagnostic_consumer.h"
 #include "postponed_statement.h"
 #include "tagged_index.h"
@@ -114,15 +115,21 @@ class symbol_dependency_tables
         delay_eval_t delay_eval);
 
     void delete_dependency(std::unordered_map<dependant, dependency_value>::iterator it);
+    void swap_dependencies(size_t l, size_t r) noexcept;
 
-    class dep_value;
-    class dep_reference;
-    class dep_iterator;
-    friend void swap(dep_reference l, dep_reference r) noexcept;
-    dep_iterator dependency_iterator(size_t idx);
-    dep_iterator dep_begin();
-    dep_iterator dep_end();
-    size_t m_dependencies_skip_index = 0;
+    // dependants waiting for a symbol or space to be defined, keyed by its hash
+    std::unordered_map<size_t, std::vector<dependant>> m_waiting_dependants;
+    // dependants whose dependencies need to be re-evaluated
+    std::vector<dependant> m_ready_dependants;
+    // dependants that are evaluated only when location counter dependencies are checked
+    std::vector<dependant> m_deferred_dependants;
+
+    void add_waiting_dependant(size_t what, const dependant& target);
+    void wake_dependants(size_t what);
+
+    // order of symbolic dependencies used to avoid searching for cycles
+    dependency_order m_dependency_order;
+    size_t m_pending_spaces = 0;
 
     // list of statements containing dependencies that can not be checked yet
     postponed_statements_t m_postponed_stmts;
@@ -135,6 +142,10 @@ class symbol_dependency_tables
     index_t<postponed_statements_t> add_postponed(post_stmt_ptr, T&&);
     void delete_postponed(index_t<postponed_statements_t>);
 
+    bool creates_cycle(const dependant& target,
+        const resolvable* dependency_source,
+        const dependency_evaluation_context& dep_ctx,
+        const library_info& li);
     bool has_cycle(dependant target, std::vector<dependant> dependencies, const library_info& li);
     bool has_cycle(space_ptr target, const library_info& li);
 
@@ -150,7 +161,7 @@ class symbol_dependency_tables
 
     std::vector<dependant> extract_dependencies(
         const resolvable* dependency_source, const dependency_evaluation_context& dep_ctx, const library_info& li);
-    bool update_dependencies(const dependency_value& v, const library_info& li);
+    bool update_dependencies(const dependant& target, const dependency_value& v, const library_info& li);
 
     dependency_value* add_dependency_with_cycle_check(id_index target,
         const resolvable* dependency_source,
@@ -22,19 +22,36 @@ statement_cache::statement_cache(shared_stmt_ptr base) noexcept
     : base_stmt_(std::move(base))
 {}
 
+statement_cache::statement_cache(shared_stmt_ptr base, statement_cache& shared) noexcept
+    : base_stmt_(std::move(base))
+    , shared_(shared.shared_ ? shared.shared_ : &shared)
+{}
+
 const statement_cache::cached_statement_t& statement_cache::insert(
     processing::processing_status_cache_key key, cached_statement_t statement)
 {
+    if (shared_)
+        return shared_->insert(key, std::move(statement));
     return cache_.emplace_back(key, std::move(statement)).second;
 }
 
 const statement_cache::cached_statement_t* statement_cache::get(
     processing::processing_status_cache_key key) const noexcept
 {
+    if (shared_)
+        return shared_->get(key);
     for (const auto& entry : cache_)
         if (entry.first == key)
             return &entry.second;
     return nullptr;
 }
 
+size_t statement_cache::memory_usage() const noexcept
+{
+    size_t result = sizeof(*this) + cache_.capacity() * sizeof(cache_t);
+    for (const auto& [_, entry] : cache_)
+        result += entry.diags.capacity() * sizeof(diagnostic_op);
+    return result;
+}
+
 } // namespace hlasm_plugin::parser_library::context
@@ -42,15 +42,21 @@ public:
 private:
     std::vector<cache_t> cache_;
     shared_stmt_ptr base_stmt_;
+    statement_cache* shared_ = nullptr;
 
 public:
     statement_cache(shared_stmt_ptr base) noexcept;
+    // reparsed formats are stored in the cache of the same statement in a copy member, which must outlive this one
+    statement_cache(shared_stmt_ptr base, statement_cache& shared) noexcept;
 
     const cached_statement_t& insert(processing::processing_status_cache_key key, cached_statement_t statement);
 
     const cached_statement_t* get(processing::processing_status_cache_key key) const noexcept;
 
     const shared_stmt_ptr& get_base() const noexcept { return base_stmt_; }
+
+    // Approximate size of the cache entries, the statements themselves are not measured
+    size_t memory_usage() const noexcept;
 };
 
 using cached_block = std::vector<statement_cache>;
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef CONTEXT_VARIABLE_SLOTS_H
+#define CONTEXT_VARIABLE_SLOTS_H
+
+#include <cstddef>
+#include <unordered_map>
+
+#include "id_index.h"
+
+namespace hlasm_plugin::parser_library::context {
+
+// assigns dense slot indices to the variable names referenced in a macro definition or in the open code
+class variable_slot_table
+{
+    std::unordered_map<id_index, size_t> m_slots;
+
+public:
+    size_t slot(id_index name) { return m_slots.try_emplace(name, m_slots.size()).first->second; }
+};
+
+// slot of a variable symbol reference, remembered between evaluations
+struct variable_slot_hint
+{
+    const variable_slot_table* table = nullptr;
+    size_t index = 0;
+};
+
+} // namespace hlasm_plugin::parser_library::context
+
+#endif
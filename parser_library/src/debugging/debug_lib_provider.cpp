@@ -30,61 +30,84 @@ debug_lib_provider::debug_lib_provider(
     , m_file_manager(fm)
 {}
 
-utils::value_task<bool> debug_lib_provider::parse_library(
-    std::string library, analyzing_context ctx, processing::processing_kind kind)
+const utils::resource::resource_location* debug_lib_provider::find_member(std::string_view library)
 {
-    utils::resource::resource_location url;
-    for (const auto& lib : m_libraries)
+    auto it = m_members.find(library);
+    if (it == m_members.end())
     {
-        if (!lib->has_file(library, &url))
-            continue;
-
-        auto content_o = co_await m_file_manager.get_converted_file_content(url);
-        if (!content_o.has_value())
-            break;
+        std::optional<utils::resource::resource_location> url;
+        for (const auto& lib : m_libraries)
+        {
+            if (utils::resource::resource_location loc; lib->has_file(library, &loc))
+            {
+                url = std::move(loc);
+                break;
+            }
+        }
+        it = m_members.try_emplace(std::string(library), std::move(url)).first;
+    }
+    return it->second ? &*it->second : nullptr;
+}
 
-        const auto& [location, content] = *m_files.try_emplace(std::move(url), std::move(content_o).value()).first;
+utils::value_task<const std::string*> debug_lib_provider::get_content(const utils::resource::resource_location& url)
+{
+    if (auto it = m_files.find(url); it != m_files.end())
+        co_return &it->second;
 
-        analyzer a(content,
-            analyzer_options {
-                location,
-                this,
-                std::move(ctx),
-                analyzer_options::dependency(std::move(library), kind),
-                collect_highlighting_info::no,
-            });
+    auto content_o = co_await m_file_manager.get_converted_file_content(url);
+    if (!content_o.has_value())
+        co_return nullptr;
 
-        co_await a.co_analyze();
+    co_return &m_files.try_emplace(url, std::move(content_o).value()).first->second;
+}
 
-        co_return true;
-    }
-    co_return false;
+utils::value_task<bool> debug_lib_provider::parse_library(
+    std::string library, analyzing_context ctx, processing::processing_kind kind)
+{
+    const auto* url = find_member(library);
+    if (!url)
+        co_return false;
+
+    const auto* content = co_await get_content(*url);
+    if (!content)
+        co_return false;
+
+    analyzer a(*content,
+        analyzer_options {
+            *url,
+            this,
+            std::move(ctx),
+            analyzer_options::dependency(std::move(library), kind),
+            collect_highlighting_info::no,
+        });
+
+    co_await a.co_analyze();
+
+    co_return true;
 }
 
 bool debug_lib_provider::has_library(std::string_view library, utils::resource::resource_location* loc)
 {
-    for (const auto& lib : m_libraries)
-        if (lib->has_file(library, loc))
-            return true;
-    return false;
+    const auto* url = find_member(library);
+    if (!url)
+        return false;
+    if (loc)
+        *loc = *url;
+    return true;
 }
 
 utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>>
 debug_lib_provider::get_library(std::string library)
 {
-    utils::resource::resource_location url;
-    for (const auto& lib : m_libraries)
-    {
-        if (!lib->has_file(library, &url))
-            continue;
+    const auto* url = find_member(library);
+    if (!url)
+        co_return std::nullopt;
 
-        auto content_o = co_await m_file_manager.get_converted_file_content(url);
-        if (!content_o.has_value())
-            break;
+    const auto* content = co_await get_content(*url);
+    if (!content)
+        co_return std::nullopt;
 
-        co_return std::pair(std::move(content_o).value(), std::move(url));
-    }
-    co_return std::nullopt;
+    co_return std::pair(*content, *url);
 }
 
 utils::task debug_lib_provider::prefetch_libraries() const
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "parse_lib_provider.h"
+#include "utils/general_hashers.h"
 #include "utils/resource_location.h"
 
 namespace hlasm_plugin::utils {
@@ -44,12 +45,22 @@ namespace hlasm_plugin::parser_library::debugging {
 // Implements dependency (macro and COPY files) fetcher for macro tracer.
 // Takes the information from a workspace, but calls special methods for
 // parsing that do not collide with LSP.
+// Member lookups and texts are retained for the lifetime of the provider,
+// so that repeated analyses observe the same library contents.
 class debug_lib_provider final : public parse_lib_provider
 {
     std::unordered_map<utils::resource::resource_location, std::string> m_files;
+    std::unordered_map<std::string,
+        std::optional<utils::resource::resource_location>,
+        utils::hashers::string_hasher,
+        std::equal_to<>>
+        m_members;
     std::vector<std::shared_ptr<workspaces::library>> m_libraries;
     workspaces::file_manager& m_file_manager;
 
+    const utils::resource::resource_location* find_member(std::string_view library);
+    [[nodiscard]] utils::value_task<const std::string*> get_content(const utils::resource::resource_location& url);
+
 public:
     debug_lib_provider(std::vector<std::shared_ptr<workspaces::library>> libraries, workspaces::file_manager& fm);
 
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <atomic>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -50,6 +51,7 @@
 #include "utils/factory.h"
 #include "utils/string_operations.h"
 #include "utils/task.h"
+#include "utils/time.h"
 #include "variable.h"
 #include "workspace_manager.h"
 #include "workspace_manager_response.h"
@@ -109,9 +111,80 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
     context::processing_stack_details_t proc_stack_;
 
     std::unordered_map<utils::resource::resource_location, std::vector<breakpoint>> breakpoints_;
+    // sorted unique lines with breakpoints, sources without breakpoints are not present
+    std::unordered_map<utils::resource::resource_location, std::vector<size_t>> breakpoint_lines_;
 
     std::unordered_set<std::string, utils::hashers::string_hasher, std::equal_to<>> function_breakpoints_;
 
+    // Replays the times observed by the first run of the session, so that &SYSDATC, &SYSDATE, &SYSTIME and
+    // &SYSCLOCK do not change when the analysis is replayed
+    class session_clock final : public utils::time_source
+    {
+        // once reached, the last observed time is repeated for the rest of the session
+        static constexpr size_t max_observed = 1 << 16;
+
+        std::vector<utils::timestamp> observed;
+        size_t next = 0;
+
+    public:
+        utils::timestamp now() override
+        {
+            if (next == max_observed)
+                return observed.back();
+            if (next == observed.size())
+                observed.push_back(utils::timestamp::now().value_or(utils::timestamp { 1900, 1, 1 }));
+            return observed[next++];
+        }
+
+        void rewind() noexcept { next = 0; }
+    };
+
+    // Inputs of the current session, retained so that the analysis can be replayed: the open code text, the library
+    // members with their texts as first read and the observed times
+    struct session_inputs
+    {
+        utils::resource::resource_location location;
+        std::string text;
+        debugger_configuration conf;
+        std::unique_ptr<debug_lib_provider> libraries;
+        session_clock clock;
+    };
+    std::optional<session_inputs> session_;
+
+    // Ordinal of the last traced statement since the analysis started
+    size_t statement_ordinal_ = 0;
+    // Statement at which the replayed analysis stops, 0 when not replaying
+    size_t replay_target_ = 0;
+
+    struct frame_variables
+    {
+        std::vector<variable> globals;
+        std::vector<variable> locals;
+    };
+
+    // Debugging information of a stop, restored without replaying the analysis
+    struct stop_state
+    {
+        std::vector<stack_frame> frames;
+        std::vector<frame_variables> variables;
+        std::vector<variable> ordinary_symbols;
+    };
+
+    struct checkpoint
+    {
+        size_t statement;
+        bool breakpoint;
+        std::shared_ptr<const stop_state> state;
+    };
+    // Statements where the execution stopped, in the order of execution, only the latest ones keep their state
+    std::vector<checkpoint> checkpoints_;
+    static constexpr size_t max_restorable_checkpoints = 32;
+
+    // State shown instead of the analysis, which stays ahead until the execution is resumed
+    std::shared_ptr<const stop_state> restored_;
+    // User control to perform once the replayed analysis reaches the restored statement
+    void (impl::*resume_command_)() = nullptr;
+
     size_t add_variable(std::vector<variable> vars)
     {
         variables_[next_var_ref_] = std::move(vars);
@@ -136,39 +209,58 @@ class debugger::impl final : public processing::statement_analyzer, output_handl
             co_return;
         }
         resp.provide(true);
-        debug_lib_provider debug_provider(std::move(dc.libraries), *dc.fm);
-        workspaces::file_manager_vfm vfm(*dc.fm);
 
-        if (auto prefetch = debug_provider.prefetch_libraries(); prefetch.valid())
+        auto libraries = std::make_unique<debug_lib_provider>(dc.libraries, *dc.fm);
+        if (auto prefetch = libraries->prefetch_libraries(); prefetch.valid())
             co_await std::move(prefetch);
 
-        analyzer a(open_code_text.value(),
+        session_ = session_inputs {
+            std::move(open_code_location),
+            std::move(open_code_text).value(),
+            std::move(dc),
+            std::move(libraries),
+        };
+
+        co_await run_analyzer();
+    }
+
+    utils::task run_analyzer()
+    {
+        statement_ordinal_ = 0;
+
+        auto& session = *session_;
+        session.clock.rewind();
+
+        workspaces::file_manager_vfm vfm(*session.conf.fm);
+
+        analyzer a(session.text,
             analyzer_options {
-                std::move(open_code_location),
-                &debug_provider,
-                std::move(dc.opts),
-                std::move(dc.pp_opts),
+                session.location,
+                session.libraries.get(),
+                session.conf.opts,
+                session.conf.pp_opts,
                 &vfm,
                 static_cast<output_handler*>(this),
+                &session.clock,
             });
 
         a.register_stmt_analyzer(this);
 
         ctx_ = a.context().hlasm_ctx.get();
-        lib_provider_ = &debug_provider;
+        lib_provider_ = session.libraries.get();
 
         co_await a.co_analyze();
     }
 
     void mnote(unsigned char level, std::string_view text) override
     {
-        if (event_)
+        if (event_ && !replay_target_)
             event_->mnote(level, text);
     }
 
     void punch(std::string_view text) override
     {
-        if (event_)
+        if (event_ && !replay_target_)
             event_->punch(text);
     }
 
@@ -184,6 +276,10 @@ public:
         continue_ = true;
         stop_on_next_stmt_ = stop_on_entry;
         stop_on_stack_changes_ = false;
+        replay_target_ = 0;
+        checkpoints_.clear();
+        restored_.reset();
+        resume_command_ = nullptr;
 
         struct conf_t
         {
@@ -249,22 +345,28 @@ public:
         if (op_code.empty())
             return false;
 
+        ++statement_ordinal_;
+
+        // replaying the statements that were already traced
+        if (replay_target_ > statement_ordinal_)
+            return false;
+
+        const bool replay_done = std::exchange(replay_target_, 0) != 0;
+        if (replay_done)
+            stop_on_next_stmt_ = true;
+
         const bool actr_limit = ctx_->get_branch_counter() < 0;
 
         const bool function_breakpoint_hit = function_breakpoints_.contains(op_code.to_string_view());
 
-        range stmt_range = resolved_stmt->stmt_range_ref();
-
-        bool breakpoint_hit = false;
+        // nothing can stop on this statement, avoid computing the processing stack
+        if (!stop_on_next_stmt_ && !function_breakpoint_hit && !actr_limit && !stop_on_stack_changes_
+            && breakpoint_lines_.empty())
+            return !continue_;
 
         auto stack_node = ctx_->processing_stack();
-        auto stack = ctx_->processing_stack_details();
 
-        for (const auto& bp : breakpoints(stack.back().resource_loc))
-        {
-            if (bp.line >= stmt_range.start.line && bp.line <= stmt_range.end.line)
-                breakpoint_hit = true;
-        }
+        const bool breakpoint_hit = has_breakpoint(stack_node.frame().resource_loc, resolved_stmt->stmt_range_ref());
 
         const auto stack_condition_violated = [&cond = stop_on_stack_condition_](context::processing_stack_t cur) {
             auto last = cur;
@@ -281,7 +383,7 @@ public:
             variables_.clear();
             stack_frames_.clear();
             scopes_.clear();
-            proc_stack_ = std::move(stack);
+            proc_stack_ = ctx_->processing_stack_details();
             last_system_variables_.clear();
 
             if (disconnected_)
@@ -292,6 +394,21 @@ public:
 
             continue_ = false;
 
+            // the state of the restored statement is already shown
+            if (replay_done && resume_command_)
+            {
+                (this->*std::exchange(resume_command_, nullptr))();
+                return !continue_;
+            }
+
+            checkpoints_.push_back({
+                statement_ordinal_,
+                breakpoint_hit || function_breakpoint_hit,
+                std::make_shared<const stop_state>(capture_stop_state()),
+            });
+            if (checkpoints_.size() > max_restorable_checkpoints)
+                checkpoints_[checkpoints_.size() - max_restorable_checkpoints - 1].state.reset();
+
             static constexpr std::string_view reasons[] = {
                 "entry",
                 "breakpoint",
@@ -304,6 +421,8 @@ public:
             {
                 if (actr_limit)
                     event_->stopped("exception", "ACTR limit reached");
+                else if (replay_done && reason_id == 0)
+                    event_->stopped("step", "");
                 else
                     event_->stopped(reasons[reason_id], "");
             }
@@ -316,18 +435,24 @@ public:
     // User controls of debugging.
     void next()
     {
+        if (resume_restored(&impl::next))
+            return;
         stop_on_stack_changes_ = true;
         continue_ = true;
     }
 
     void step_in()
     {
+        if (resume_restored(&impl::step_in))
+            return;
         stop_on_next_stmt_ = true;
         continue_ = true;
     }
 
     void step_out()
     {
+        if (resume_restored(&impl::step_out))
+            return;
         if (!stop_on_stack_condition_.first.empty())
         {
             stop_on_stack_changes_ = true;
@@ -349,12 +474,88 @@ public:
 
     void continue_debug()
     {
+        if (resume_restored(&impl::continue_debug))
+            return;
         stop_on_next_stmt_ = false;
         continue_ = true;
     }
 
     void pause() { stop_on_next_stmt_ = true; }
 
+    // Shows the state recorded when the execution stopped on the requested statement, or restarts the analysis and
+    // silently executes it up to the statement when the state is no longer available
+    void replay_to(size_t statement)
+    {
+        if (!session_ || debug_ended_ || continue_)
+            return;
+
+        if (statement == statement_ordinal_)
+        {
+            if (event_)
+                event_->stopped("step", "");
+            return;
+        }
+
+        std::erase_if(checkpoints_, [statement](const auto& c) { return c.statement > statement; });
+
+        variables_.clear();
+        stack_frames_.clear();
+        scopes_.clear();
+        last_system_variables_.clear();
+
+        if (!checkpoints_.empty() && checkpoints_.back().statement == statement && checkpoints_.back().state)
+        {
+            restored_ = checkpoints_.back().state;
+            statement_ordinal_ = statement;
+            if (event_)
+                event_->stopped(checkpoints_.back().breakpoint ? "breakpoint" : "step", "");
+            return;
+        }
+
+        if (!checkpoints_.empty() && checkpoints_.back().statement == statement)
+            checkpoints_.pop_back();
+
+        start_replay(statement);
+    }
+
+    // Replays the analysis up to the restored statement and performs the control there
+    bool resume_restored(void (impl::*command)())
+    {
+        if (!restored_ || continue_)
+            return false;
+
+        resume_command_ = command;
+        start_replay(statement_ordinal_);
+        return true;
+    }
+
+    void start_replay(size_t statement)
+    {
+        restored_.reset();
+        proc_stack_.clear();
+
+        analyzer_task = {};
+        ctx_ = nullptr;
+        lib_provider_ = nullptr;
+
+        stop_on_next_stmt_ = false;
+        stop_on_stack_changes_ = false;
+        replay_target_ = statement;
+        continue_ = true;
+
+        analyzer_task = run_analyzer();
+    }
+
+    void step_back() { replay_to(std::max<size_t>(statement_ordinal_, 2) - 1); }
+
+    void reverse_continue()
+    {
+        const auto cp = std::find_if(checkpoints_.rbegin(), checkpoints_.rend(), [this](const auto& c) {
+            return c.breakpoint && c.statement < statement_ordinal_;
+        });
+        replay_to(cp == checkpoints_.rend() ? std::min<size_t>(statement_ordinal_, 1) : cp->statement);
+    }
+
     static std::string fpt_to_string(context::file_processing_type fpt)
     {
         switch (fpt)
@@ -376,6 +577,11 @@ public:
         stack_frames_.clear();
         if (debug_ended_)
             return stack_frames_;
+        if (restored_)
+        {
+            stack_frames_ = restored_->frames;
+            return stack_frames_;
+        }
         for (size_t i = proc_stack_.size() - 1; i != (size_t)-1; --i)
         {
             const auto& frame = proc_stack_[i];
@@ -397,12 +603,34 @@ public:
         if (debug_ended_)
             return scopes_;
 
-        if (frame_id >= proc_stack_.size())
-            return scopes_;
+        if (restored_)
+        {
+            if (frame_id >= restored_->variables.size())
+                return scopes_;
+            add_scopes(restored_->variables[frame_id], restored_->ordinary_symbols);
+        }
+        else
+        {
+            if (frame_id >= proc_stack_.size())
+                return scopes_;
+            add_scopes(collect_frame_variables(frame_id), collect_ordinary_symbols());
+        }
 
+        return scopes_;
+    }
+
+    void add_scopes(frame_variables vars, std::vector<variable> ordinary_symbols)
+    {
+        scopes_.emplace_back("Globals", add_variable(std::move(vars.globals)), source(opencode_source_uri_));
+        scopes_.emplace_back("Locals", add_variable(std::move(vars.locals)), source(opencode_source_uri_));
+        scopes_.emplace_back(
+            "Ordinary symbols", add_variable(std::move(ordinary_symbols)), source(opencode_source_uri_));
+    }
+
+    frame_variables collect_frame_variables(frame_id_t frame_id)
+    {
         std::vector<variable> scope_vars;
         std::vector<variable> globals;
-        std::vector<variable> ordinary_symbols;
         // we show only global variables that are valid for current scope,
         // moreover if we show variable in globals, we do not show it in locals
 
@@ -438,20 +666,60 @@ public:
             // fetch all vars
         }
 
+        std::ranges::sort(globals, {}, &variable::name);
+        std::ranges::sort(scope_vars, {}, &variable::name);
+
+        return { std::move(globals), std::move(scope_vars) };
+    }
+
+    std::vector<variable> collect_ordinary_symbols() const
+    {
+        std::vector<variable> ordinary_symbols;
         for (const auto& it : ctx_->ord_ctx.symbols())
             if (const auto* sym = std::get_if<context::symbol>(&it.second))
                 ordinary_symbols.push_back(generate_ordinary_symbol_variable(*sym));
 
-        std::ranges::sort(globals, {}, &variable::name);
-        std::ranges::sort(scope_vars, {}, &variable::name);
         std::ranges::sort(ordinary_symbols, {}, &variable::name);
 
-        scopes_.emplace_back("Globals", add_variable(std::move(globals)), source(opencode_source_uri_));
-        scopes_.emplace_back("Locals", add_variable(std::move(scope_vars)), source(opencode_source_uri_));
-        scopes_.emplace_back(
-            "Ordinary symbols", add_variable(std::move(ordinary_symbols)), source(opencode_source_uri_));
+        return ordinary_symbols;
+    }
 
-        return scopes_;
+    // Evaluates the values of composite variables, so that they do not refer to the analysis any more
+    static variable freeze(variable var)
+    {
+        if (var.is_scalar())
+            return var;
+
+        auto values = var.values();
+        for (auto& v : values)
+            v = freeze(std::move(v));
+        var.values = [values = std::move(values)]() { return values; };
+
+        return var;
+    }
+
+    static std::vector<variable> freeze(std::vector<variable> vars)
+    {
+        for (auto& v : vars)
+            v = freeze(std::move(v));
+        return vars;
+    }
+
+    stop_state capture_stop_state()
+    {
+        stop_state state {
+            .frames = stack_frames(),
+            .variables = {},
+            .ordinary_symbols = freeze(collect_ordinary_symbols()),
+        };
+
+        for (frame_id_t frame_id = 0; frame_id < proc_stack_.size(); ++frame_id)
+        {
+            auto [globals, locals] = collect_frame_variables(frame_id);
+            state.variables.push_back({ freeze(std::move(globals)), freeze(std::move(locals)) });
+        }
+
+        return state;
     }
 
     std::span<const hlasm_plugin::parser_library::debugging::variable> variables(var_reference_t var_ref)
@@ -663,11 +931,36 @@ public:
         return evaluated_expression_value(std::move(var->value), var->is_scalar() ? 0 : add_variable(var->values()));
     }
 
+    // Only variables are available at a restored statement, expressions need the analysis
+    evaluated_expression evaluate_restored(std::string_view expr, frame_id_t frame_id)
+    {
+        if (frame_id == (size_t)-1)
+            frame_id = restored_->variables.size() - 1;
+
+        if (frame_id >= restored_->variables.size())
+            return evaluated_expression_error("Invalid frame id");
+
+        if (!expr.starts_with("&") || !lexing::is_valid_symbol_name(expr.substr(1)))
+            return evaluated_expression_error("Only variables can be evaluated before the execution continues");
+
+        const auto name = "&" + utils::to_upper_copy(expr.substr(1));
+        for (const auto& [globals, locals] = restored_->variables[frame_id]; const auto* vars : { &locals, &globals })
+        {
+            if (auto it = std::ranges::find(*vars, name, &variable::name); it != vars->end())
+                return evaluated_expression_value(it->value, it->is_scalar() ? 0 : add_variable(it->values()));
+        }
+
+        return evaluated_expression_error("Variable not found");
+    }
+
     evaluated_expression evaluate(std::string_view expr, frame_id_t frame_id)
     {
         if (debug_ended_ || expr.empty())
             return evaluated_expression_value();
 
+        if (restored_)
+            return evaluate_restored(expr, frame_id);
+
         if (frame_id == (size_t)-1)
             frame_id = proc_stack_.size() - 1;
 
@@ -732,6 +1025,28 @@ public:
     void breakpoints(const utils::resource::resource_location& source, std::span<const breakpoint> bps)
     {
         breakpoints_[source].assign(bps.begin(), bps.end());
+
+        if (bps.empty())
+        {
+            breakpoint_lines_.erase(source);
+            return;
+        }
+
+        auto& lines = breakpoint_lines_[source];
+        lines.clear();
+        std::ranges::transform(bps, std::back_inserter(lines), &breakpoint::line);
+        std::ranges::sort(lines);
+        lines.erase(std::ranges::unique(lines).begin(), lines.end());
+    }
+
+    bool has_breakpoint(const utils::resource::resource_location& source, const range& stmt_range) const
+    {
+        const auto it = breakpoint_lines_.find(source);
+        if (it == breakpoint_lines_.end())
+            return false;
+
+        const auto line = std::ranges::lower_bound(it->second, stmt_range.start.line);
+        return line != it->second.end() && *line <= stmt_range.end.line;
     }
 
     [[nodiscard]] std::span<const breakpoint> breakpoints(const utils::resource::resource_location& source) const
@@ -785,6 +1100,8 @@ void debugger::step_out() { pimpl->step_out(); }
 void debugger::disconnect() { pimpl->disconnect(); }
 void debugger::continue_debug() { pimpl->continue_debug(); }
 void debugger::pause() { pimpl->pause(); }
+void debugger::step_back() { pimpl->step_back(); }
+void debugger::reverse_continue() { pimpl->reverse_continue(); }
 void debugger::analysis_step(const std::atomic<unsigned char>* yield_indicator) { pimpl->step(yield_indicator); }
 
 
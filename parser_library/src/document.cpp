@@ -53,13 +53,13 @@ std::string document::text() const
     });
 }
 
-void document::convert_to_replaced()
+void document::convert_to_borrowed() noexcept
 {
     for (auto& line : m_lines)
     {
         if (line.is_original())
         {
-            line = document_line(replaced_line { std::string(line.text()) });
+            line = document_line(borrowed_line { line.text() });
         }
     }
 }
@@ -14,6 +14,12 @@
 
 #include "ebcdic_encoding.h"
 
+#include <algorithm>
+#include <iterator>
+#include <string_view>
+
+#include "utils/unicode_text.h"
+
 namespace hlasm_plugin::parser_library {
 
 std::pair<unsigned char, const char*> ebcdic_encoding::to_ebcdic_multibyte(const char* c, const char* const ce) noexcept
@@ -68,7 +74,13 @@ std::string ebcdic_encoding::to_ascii(const std::string& s)
     std::string a;
     a.reserve(s.length());
     for (char c : s)
-        a.append(to_ascii(static_cast<unsigned char>(c)));
+    {
+        const auto e = static_cast<unsigned char>(c);
+        if (const auto val = e2a[e]; val < 0x80 && e != 0x0D && e != 0x25) [[likely]]
+            a.push_back(static_cast<char>(val));
+        else
+            a.append(to_ascii(e));
+    }
     return a;
 }
 
@@ -79,7 +91,16 @@ std::string ebcdic_encoding::to_ebcdic(const std::string& s)
     const auto end = std::to_address(s.end());
     for (const char* i = s.data(); i != end;)
     {
-        const auto [ch, newi] = to_ebcdic(i, end);
+        // convert runs of 7-bit characters directly through the table
+        const auto ascii = utils::ascii_prefix_length(std::string_view(i, end));
+        std::transform(i, i + ascii, std::back_inserter(a), [](char c) {
+            return static_cast<char>(a2e[static_cast<unsigned char>(c)]);
+        });
+        i += ascii;
+        if (i == end)
+            break;
+
+        const auto [ch, newi] = to_ebcdic_multibyte(i, end);
         a.push_back(static_cast<char>(ch));
         i = newi;
     }
@@ -15,6 +15,8 @@
 #include "ca_expression.h"
 
 #include "expressions/evaluation_context.h"
+#include "library_info_transitional.h"
+#include "terms/ca_constant.h"
 
 namespace hlasm_plugin::parser_library::expressions {
 
@@ -23,6 +25,21 @@ ca_expression::ca_expression(context::SET_t_enum expr_kind, range expr_range)
     , expr_kind(expr_kind)
 {}
 
+void ca_expression::fold_constants(ca_expr_ptr& expr, context::hlasm_context& ctx)
+{
+    if (!expr || !expr->fold_operands(ctx) || expr->expr_kind != context::SET_t_enum::A_TYPE)
+        return;
+
+    // expressions producing diagnostics must report them on every evaluation
+    bool diagnosed = false;
+    diagnostic_consumer_transform diags([&diagnosed](diagnostic_op) { diagnosed = true; });
+    const auto value = expr->evaluate(evaluation_context(ctx, library_info_transitional::empty, diags));
+    if (diagnosed || value.type() != context::SET_t_enum::A_TYPE)
+        return;
+
+    expr = std::make_unique<ca_constant>(value.access_a(), expr->expr_range);
+}
+
 context::SET_t ca_expression::convert_return_types(
     context::SET_t retval, context::SET_t_enum type, const evaluation_context&) const
 {
@@ -23,6 +23,10 @@
 #include "diagnostic_consumer.h"
 #include "range.h"
 
+namespace hlasm_plugin::parser_library::context {
+class hlasm_context;
+} // namespace hlasm_plugin::parser_library::context
+
 namespace hlasm_plugin::parser_library::expressions {
 
 class ca_expr_visitor;
@@ -58,6 +62,7 @@ public:
     context::SET_t_enum expr_kind : 2;
     bool is_ca_string : 1 = false;
     bool is_t_attr_var : 1 = false;
+    bool is_ca_constant : 1 = false;
 
     ca_expression(context::SET_t_enum expr_kind, range expr_range);
 
@@ -79,9 +84,15 @@ public:
 
     virtual bool is_compatible(ca_expression_compatibility) const { return false; }
 
+    // replaces subexpressions that do not depend on the state of the evaluation with constants
+    static void fold_constants(ca_expr_ptr& expr, context::hlasm_context& ctx);
+
     virtual ~ca_expression() = default;
 
 protected:
+    // folds operands of the expression, returns true when the expression itself can be evaluated in advance
+    virtual bool fold_operands(context::hlasm_context&) { return false; }
+
     context::SET_t convert_return_types(
         context::SET_t retval, context::SET_t_enum type, const evaluation_context& eval_ctx) const;
 };
@@ -68,6 +68,13 @@ context::SET_t ca_binary_operator::evaluate(const evaluation_context& eval_ctx)
     return operation(left_expr->evaluate(eval_ctx), right_expr->evaluate(eval_ctx), eval_ctx);
 }
 
+bool ca_binary_operator::fold_operands(context::hlasm_context& ctx)
+{
+    fold_constants(left_expr, ctx);
+    fold_constants(right_expr, ctx);
+    return left_expr->is_ca_constant && right_expr->is_ca_constant;
+}
+
 ca_function_binary_operator::ca_function_binary_operator(ca_expr_ptr left_expr,
     ca_expr_ptr right_expr,
     ca_expr_ops function,
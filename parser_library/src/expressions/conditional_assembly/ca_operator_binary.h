@@ -26,8 +26,8 @@ namespace hlasm_plugin::parser_library::expressions {
 class ca_binary_operator : public ca_expression
 {
 public:
-    const ca_expr_ptr left_expr;
-    const ca_expr_ptr right_expr;
+    ca_expr_ptr left_expr;
+    ca_expr_ptr right_expr;
 
     ca_binary_operator(ca_expr_ptr left_expr, ca_expr_ptr right_expr, context::SET_t_enum expr_kind, range expr_range);
 
@@ -44,6 +44,9 @@ public:
 
     virtual context::SET_t operation(
         context::SET_t lhs, context::SET_t rhs, const evaluation_context& eval_ctx) const = 0;
+
+protected:
+    bool fold_operands(context::hlasm_context& ctx) override;
 };
 
 // binary CA operators - + - * / .
@@ -53,6 +53,12 @@ context::SET_t ca_unary_operator::evaluate(const evaluation_context& eval_ctx) c
     return operation(expr->evaluate(eval_ctx), eval_ctx);
 }
 
+bool ca_unary_operator::fold_operands(context::hlasm_context& ctx)
+{
+    fold_constants(expr, ctx);
+    return expr->is_ca_constant;
+}
+
 ca_function_unary_operator::ca_function_unary_operator(ca_expr_ptr expr,
     ca_expr_ops function,
     context::SET_t_enum kind,
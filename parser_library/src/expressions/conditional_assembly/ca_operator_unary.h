@@ -23,7 +23,7 @@ namespace hlasm_plugin::parser_library::expressions {
 class ca_unary_operator : public ca_expression
 {
 public:
-    const ca_expr_ptr expr;
+    ca_expr_ptr expr;
 
     ca_unary_operator(ca_expr_ptr expr, context::SET_t_enum expr_kind, range expr_range);
 
@@ -39,6 +39,9 @@ public:
     context::SET_t evaluate(const evaluation_context& eval_ctx) const override;
 
     virtual context::SET_t operation(context::SET_t operand, const evaluation_context& eval_ctx) const = 0;
+
+protected:
+    bool fold_operands(context::hlasm_context& ctx) override;
 };
 
 class ca_plus_operator final : public ca_unary_operator
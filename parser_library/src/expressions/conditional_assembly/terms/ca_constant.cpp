@@ -24,7 +24,9 @@ namespace hlasm_plugin::parser_library::expressions {
 ca_constant::ca_constant(context::A_t value, range expr_range)
     : ca_expression(context::SET_t_enum::A_TYPE, std::move(expr_range))
     , value(value)
-{}
+{
+    is_ca_constant = true;
+}
 
 bool ca_constant::get_undefined_attributed_symbols(std::vector<context::id_index>&, const evaluation_context&) const
 {
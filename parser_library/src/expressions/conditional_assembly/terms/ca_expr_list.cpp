@@ -72,6 +72,13 @@ bool ca_expr_list::is_character_expression(character_expression_purpose purpose)
 
 void ca_expr_list::apply(ca_expr_visitor& visitor) const { visitor.visit(*this); }
 
+bool ca_expr_list::fold_operands(context::hlasm_context& ctx)
+{
+    for (auto& expr : expr_list)
+        fold_constants(expr, ctx);
+    return expr_list.size() == 1 && expr_list.front()->is_ca_constant;
+}
+
 context::SET_t ca_expr_list::evaluate(const evaluation_context& eval_ctx) const
 {
     assert(expr_list.size() <= 1);
@@ -46,6 +46,9 @@ public:
 
     std::span<const ca_expr_ptr> expression_list() const;
 
+protected:
+    bool fold_operands(context::hlasm_context& ctx) override;
+
 private:
     // this function is present due to the fact that in hlasm you can omit space between operator and operands if
     // operators are in parentheses (eg. ('A')FIND('B') )
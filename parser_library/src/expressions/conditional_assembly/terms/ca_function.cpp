@@ -108,6 +108,14 @@ bool ca_function::is_character_expression(character_expression_purpose purpose)
 
 void ca_function::apply(ca_expr_visitor& visitor) const { visitor.visit(*this); }
 
+bool ca_function::fold_operands(context::hlasm_context& ctx)
+{
+    for (auto& expr : parameters)
+        fold_constants(expr, ctx);
+    fold_constants(duplication_factor, ctx);
+    return false;
+}
+
 context::SET_t ca_function::evaluate(const evaluation_context& eval_ctx) const
 {
     context::SET_t str_ret;
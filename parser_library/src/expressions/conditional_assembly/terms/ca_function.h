@@ -89,6 +89,9 @@ public:
     static context::SET_t X2C(const context::C_t& param, diagnostic_adder& add_diagnostic);
     static context::SET_t X2D(const context::C_t& param, diagnostic_adder& add_diagnostic);
 
+protected:
+    bool fold_operands(context::hlasm_context& ctx) override;
+
 private:
     context::SET_t get_ith_param(size_t idx, const evaluation_context& eval_ctx) const;
 };
@@ -86,6 +86,14 @@ context::A_t ca_string::compute_duplication_factor(const ca_expr_ptr& dupl_facto
     return dupl;
 }
 
+bool ca_string::fold_operands(context::hlasm_context& ctx)
+{
+    fold_constants(duplication_factor, ctx);
+    fold_constants(substring.start, ctx);
+    fold_constants(substring.count, ctx);
+    return false;
+}
+
 context::SET_t ca_string::evaluate(const evaluation_context& eval_ctx) const
 {
     context::A_t dupl = compute_duplication_factor(duplication_factor, eval_ctx);
@@ -52,6 +52,9 @@ public:
     static context::A_t compute_duplication_factor(const ca_expr_ptr& dupl_factor, const evaluation_context& eval_ctx);
     static std::string duplicate(
         context::A_t dupl, std::string value, range expr_range, const evaluation_context& eval_ctx);
+
+protected:
+    bool fold_operands(context::hlasm_context& ctx) override;
 };
 
 } // namespace hlasm_plugin::parser_library::expressions
@@ -332,7 +332,7 @@ std::optional<context::C_t> read_string_var_sym(
     {
         auto data = mac_par->get_data(indices);
 
-        while (dynamic_cast<const context::macro_param_data_composite*>(data))
+        while (data->is_sublist())
             data = data->get_ith(1);
 
         var_value = data->get_value();
@@ -84,10 +84,10 @@ context::dependency_collector mach_expr_symbol::get_dependencies(context::depend
         {
             if (!reloc_value.is_simple())
                 return context::dependency_collector::error();
-            auto bp = std::make_shared<context::address::base_entry>(reloc_value.bases().front());
-            bp->qualifier = qualifier;
+            auto base = reloc_value.bases().front();
+            base.qualifier = qualifier;
             return context::dependency_collector(
-                std::move(reloc_value).with_base_list(context::address::base_list(std::move(bp))));
+                std::move(reloc_value).with_base_list(context::address::base_list(base)));
         }
         return context::dependency_collector(std::move(reloc_value));
     }
@@ -120,9 +120,9 @@ mach_expr_constant::value_t mach_expr_symbol::evaluate(
             {
                 if (const auto& reloc_value = result.get_reloc(); reloc_value.is_simple())
                 {
-                    auto bp = std::make_shared<context::address::base_entry>(reloc_value.bases().front());
-                    bp->qualifier = qualifier;
-                    return std::move(result).get_reloc().with_base_list(context::address::base_list(std::move(bp)));
+                    auto base = reloc_value.bases().front();
+                    base.qualifier = qualifier;
+                    return std::move(result).get_reloc().with_base_list(context::address::base_list(base));
                 }
                 diags.add_diagnostic(diagnostic_op::error_ME006(get_range()));
             }
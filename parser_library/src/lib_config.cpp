@@ -18,6 +18,7 @@ namespace hlasm_plugin::parser_library {
 
 const lib_config default_config {
     .diag_supress_limit = 10,
+    .memory_budget = 0,
 };
 
 namespace {
@@ -25,6 +26,8 @@ lib_config combine_two_configs(lib_config combined, const lib_config& second)
 {
     if (!combined.diag_supress_limit.has_value())
         combined.diag_supress_limit = second.diag_supress_limit;
+    if (!combined.memory_budget.has_value())
+        combined.memory_budget = second.memory_budget;
     return combined;
 }
 } // namespace
@@ -259,6 +259,14 @@ file_slice_t file_slice_t::transform_slice(
 
 const std::vector<symbol_occurrence>& file_info::get_occurrences() const { return occurrences; }
 
+std::size_t file_info::memory_usage() const noexcept
+{
+    return sizeof(*this) + slices.capacity() * sizeof(file_slice_t)
+        + occurrences.capacity() * sizeof(symbol_occurrence)
+        + line_details.capacity() * sizeof(line_occurence_details)
+        + occurrences_start_limit.capacity() * sizeof(size_t);
+}
+
 void file_info::process_occurrences()
 {
     std::ranges::sort(occurrences, {}, [](const auto& e) {
@@ -273,8 +281,8 @@ void file_info::process_occurrences()
     });
 }
 
-void file_info::collect_instruction_like_references(
-    std::unordered_map<context::id_index, utils::resource::resource_location>& m) const
+void file_info::collect_instruction_like_references(const std::vector<symbol_occurrence>& occurrences,
+    std::unordered_map<context::id_index, utils::resource::resource_location>& m)
 {
     for (const auto& occ : occurrences)
     {
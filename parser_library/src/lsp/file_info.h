@@ -102,8 +102,8 @@ public:
         const std::vector<line_occurence_details>& line_details_upd);
     const std::vector<symbol_occurrence>& get_occurrences() const;
     void process_occurrences();
-    void collect_instruction_like_references(
-        std::unordered_map<context::id_index, utils::resource::resource_location>& m) const;
+    static void collect_instruction_like_references(const std::vector<symbol_occurrence>& occurrences,
+        std::unordered_map<context::id_index, utils::resource::resource_location>& m);
 
     const symbol_occurrence* find_closest_instruction(position pos) const noexcept;
     std::pair<const context::section*, index_t<context::using_collection>> find_reachable_sections(position pos) const;
@@ -113,6 +113,9 @@ public:
 
     std::vector<bool> macro_map() const;
 
+    // Approximate size of the retained occurrence data
+    std::size_t memory_usage() const noexcept;
+
     static void distribute_macro_slices(
         const std::unordered_map<const context::macro_definition*, macro_info_ptr>& macros,
         std::unordered_map<utils::resource::resource_location, file_info>& files);
@@ -277,15 +277,15 @@ void lsp_context::add_opencode(opencode_info_ptr opencode_i, text_data_view text
 
     file_info::distribute_macro_slices(m_macros, m_files);
 
-    for (const auto& [_, m] : m_macros)
-        distribute_file_occurrences(m->file_occurrences);
-    distribute_file_occurrences(m_opencode->file_occurrences);
-
-    for (auto& [_, file] : m_files)
-        file.process_occurrences();
+    // Sorting and indexing of the occurrences is postponed until a request needs the particular file
+    for (const auto& [loc, _] : m_files)
+        m_unprocessed_files.insert(loc);
 
-    for (const auto& [_, file] : m_files)
-        file.collect_instruction_like_references(m_instr_like);
+    for (const auto& [_, m] : m_macros)
+        for (const auto& [__, occs] : m->file_occurrences)
+            file_info::collect_instruction_like_references(occs.symbols, m_instr_like);
+    for (const auto& [_, occs] : m_opencode->file_occurrences)
+        file_info::collect_instruction_like_references(occs.symbols, m_instr_like);
 
     std::erase_if(m_instr_like, [this](const auto& e) { return have_suggestions_for_instr_like(e.first); });
     for (auto& [key, value] : m_instr_like)
@@ -311,10 +311,7 @@ macro_info_ptr lsp_context::get_macro_info(context::id_index macro_name, context
 
 const file_info* lsp_context::get_file_info(const utils::resource::resource_location& file_loc) const
 {
-    if (auto it = m_files.find(file_loc); it != m_files.end())
-        return &it->second;
-    else
-        return nullptr;
+    return process_file(file_loc);
 }
 
 location lsp_context::definition(const utils::resource::resource_location& document_loc, position pos) const
@@ -554,25 +551,43 @@ completion_list_source lsp_context::complete_instr(const file_info& fi, position
     return result;
 }
 
-void lsp_context::distribute_file_occurrences(const file_occurrences_t& occurrences)
+file_info* lsp_context::process_file(const utils::resource::resource_location& file_loc) const
 {
-    for (auto& [file, occs] : occurrences)
-        m_files.at(file).update_occurrences(occs.symbols, occs.line_details);
+    auto it = m_files.find(file_loc);
+    if (it == m_files.end())
+        return nullptr;
+
+    auto& file = it->second;
+    if (auto pending = m_unprocessed_files.find(file_loc); pending != m_unprocessed_files.end())
+    {
+        m_unprocessed_files.erase(pending);
+
+        // same order as the statements were collected in - macros first, then the opencode
+        for (const auto& [_, m] : m_macros)
+            if (auto occs = m->file_occurrences.find(file_loc); occs != m->file_occurrences.end())
+                file.update_occurrences(occs->second.symbols, occs->second.line_details);
+        if (auto occs = m_opencode->file_occurrences.find(file_loc); occs != m_opencode->file_occurrences.end())
+            file.update_occurrences(occs->second.symbols, occs->second.line_details);
+
+        file.process_occurrences();
+    }
+
+    return &file;
 }
 
 occurrence_scope_t lsp_context::find_occurrence_with_scope(
     const utils::resource::resource_location& document_loc, position pos) const
 {
-    if (auto file = m_files.find(document_loc); file != m_files.end())
-        return file->second.find_occurrence_with_scope(pos);
+    if (const auto* file = process_file(document_loc))
+        return file->find_occurrence_with_scope(pos);
     return std::make_pair(nullptr, nullptr);
 }
 
 const line_occurence_details* lsp_context::find_line_details(
     const utils::resource::resource_location& document_loc, size_t l) const
 {
-    if (auto file = m_files.find(document_loc); file != m_files.end())
-        return file->second.get_line_details(l);
+    if (const auto* file = process_file(document_loc))
+        return file->get_line_details(l);
     return nullptr;
 }
 
@@ -803,16 +818,32 @@ std::string lsp_context::find_hover(const symbol_occurrence& occ,
     return {};
 }
 
+std::size_t lsp_context::memory_usage() const noexcept
+{
+    std::size_t result = sizeof(*this) + m_titles.capacity() * sizeof(title_details)
+        + m_instr_like.size() * sizeof(decltype(m_instr_like)::value_type)
+        + m_macros.size() * sizeof(decltype(m_macros)::value_type);
+    for (const auto& [_, fi] : m_files)
+        result += fi.memory_usage();
+    result += m_unprocessed_files.size() * sizeof(decltype(m_unprocessed_files)::value_type);
+    if (m_opencode)
+    {
+        for (const auto& [_, occs] : m_opencode->file_occurrences)
+            result += occs.symbols.capacity() * sizeof(symbol_occurrence)
+                + occs.line_details.capacity() * sizeof(line_occurence_details);
+    }
+    return result;
+}
 
 std::vector<branch_info> lsp_context::get_opencode_branch_info() const
 {
     std::vector<branch_info> result;
 
-    auto file = m_files.find(m_hlasm_ctx->opencode_location());
-    if (file == m_files.end())
+    const auto* file = process_file(m_hlasm_ctx->opencode_location());
+    if (!file)
         return result;
 
-    const auto& details = file->second.get_line_details();
+    const auto& details = file->get_line_details();
     for (size_t i = 0; i < details.size(); ++i)
     {
         const auto& ld = details[i];
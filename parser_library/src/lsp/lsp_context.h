@@ -17,6 +17,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -51,7 +52,9 @@ class lsp_context final
 {
     opencode_info_ptr m_opencode;
     std::unordered_map<const context::macro_definition*, macro_info_ptr> m_macros;
-    std::unordered_map<utils::resource::resource_location, file_info> m_files;
+    // Occurrences are distributed to the files lazily, when a request first touches the file
+    mutable std::unordered_map<utils::resource::resource_location, file_info> m_files;
+    mutable std::unordered_set<utils::resource::resource_location> m_unprocessed_files;
 
     std::shared_ptr<context::hlasm_context> m_hlasm_ctx;
 
@@ -106,8 +109,11 @@ public:
 
     std::vector<branch_info> get_opencode_branch_info() const;
 
+    // Approximate size of the occurrence data collected for all files
+    std::size_t memory_usage() const noexcept;
+
 private:
-    void distribute_file_occurrences(const file_occurrences_t& occurrences);
+    file_info* process_file(const utils::resource::resource_location& file_loc) const;
 
     occurrence_scope_t find_occurrence_with_scope(
         const utils::resource::resource_location& document_loc, position pos) const;
@@ -1038,7 +1038,9 @@ void parser2::lex_line_remark()
 
 void parser2::resolve_expression(expressions::ca_expr_ptr& expr, size_t i) const
 {
-    diagnostic_consumer_transform diags([collector = holder->diagnostic_collector](diagnostic_op d) {
+    bool diagnosed = false;
+    diagnostic_consumer_transform diags([collector = holder->diagnostic_collector, &diagnosed](diagnostic_op d) {
+        diagnosed = true;
         if (collector)
             collector->add_diagnostic(std::move(d));
     });
@@ -1086,6 +1088,9 @@ void parser2::resolve_expression(expressions::ca_expr_ptr& expr, size_t i) const
         assert(false);
         expr->resolve_expression_tree({ UNDEF_TYPE, UNDEF_TYPE, true }, diags);
     }
+
+    if (!diagnosed && holder->hlasm_ctx)
+        expressions::ca_expression::fold_constants(expr, *holder->hlasm_ctx);
 }
 
 void parser2::resolve_concat_chain(const semantics::concat_chain& chain) const
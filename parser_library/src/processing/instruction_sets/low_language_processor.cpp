@@ -41,8 +41,8 @@ low_language_processor::low_language_processor(const analyzing_context& ctx,
 
 rebuilt_statement low_language_processor::preprocess(std::shared_ptr<const processing::resolved_statement> stmt)
 {
-    auto [label, ops, literals, was_model] = preprocess_inner(*stmt);
-    rebuilt_statement result(std::move(stmt), std::move(label), std::move(ops), std::move(literals));
+    auto [label, ops, was_model] = preprocess_inner(*stmt);
+    rebuilt_statement result(std::move(stmt), std::move(label), std::move(ops));
     if (was_model)
         proc_mgr.run_analyzers(result, true);
     return result;
@@ -135,22 +135,50 @@ low_language_processor::preprocessed_part low_language_processor::preprocess_inn
         !operands_ref.value.empty() && operands_ref.value[0]->type == operand_type::MODEL)
     {
         assert(operands_ref.value.size() == 1);
-        const auto* model = operands_ref.value[0]->access_model();
-        auto [field, map] = concatenation_point::evaluate_with_range_map(model->chain, eval_ctx);
-        auto [operands, _, literals] = parser.parse_operand_field(lexing::u8string_view_with_newlines(field),
-            true,
-            range_provider(std::move(map), model->line_limits),
-            0,
-            processing_status(stmt.format_ref(), stmt.opcode_ref()),
-            diag_ctx);
-        result.operands.emplace(std::move(operands));
-        result.literals.emplace(std::move(literals));
+        result.operands = reparse_model_operands(stmt, *operands_ref.value[0]->access_model());
         result.was_model = true;
     }
 
     return result;
 }
 
+std::shared_ptr<const reparsed_operands> low_language_processor::reparse_model_operands(
+    const resolved_statement& stmt, const semantics::model_operand& model)
+{
+    using namespace semantics;
+
+    auto [field, map] = concatenation_point::evaluate_with_range_map(model.chain, eval_ctx);
+    const processing_status status(stmt.format_ref(), stmt.opcode_ref());
+
+    auto* const cache = stmt.reparse_cache();
+    if (const auto* cached = cache ? cache->find(field, map, status) : nullptr)
+    {
+        for (const auto& d : cached->diags)
+            add_diagnostic(d);
+        return cached->result;
+    }
+
+    std::vector<diagnostic_op> diags;
+    diagnostic_consumer_transform diag_collector([&diags](diagnostic_op d) { diags.push_back(std::move(d)); });
+
+    auto [operands, _, literals] = parser.parse_operand_field(lexing::u8string_view_with_newlines(field),
+        true,
+        range_provider(cache ? map : std::move(map), model.line_limits),
+        0,
+        status,
+        diag_collector);
+    auto result =
+        std::make_shared<const reparsed_operands>(reparsed_operands { std::move(operands), std::move(literals) });
+
+    for (const auto& d : diags)
+        add_diagnostic(d);
+
+    if (cache)
+        cache->insert({ std::move(field), std::move(map), status.second, status.first, result, std::move(diags) });
+
+    return result;
+}
+
 check_org_result check_address_for_ORG(
     const context::address& addr_to_check, const context::address& curr_addr, size_t boundary, int offset)
 {
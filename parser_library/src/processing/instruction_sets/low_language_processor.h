@@ -58,11 +58,12 @@ private:
     struct preprocessed_part
     {
         std::optional<semantics::label_si> label;
-        std::optional<semantics::operands_si> operands;
-        std::optional<std::vector<semantics::literal_si>> literals;
+        std::shared_ptr<const reparsed_operands> operands;
         bool was_model = false;
     };
     preprocessed_part preprocess_inner(const resolved_statement& stmt);
+    std::shared_ptr<const reparsed_operands> reparse_model_operands(
+        const resolved_statement& stmt, const semantics::model_operand& model);
 };
 
 enum class check_org_result
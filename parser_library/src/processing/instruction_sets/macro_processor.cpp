@@ -301,6 +301,22 @@ context::hlasm_context::name_result is_keyword(const semantics::concat_chain& ch
 }
 
 namespace {
+context::macro_data_ptr parse_deferred_macrodata(std::string data)
+{
+    diagnostic_adder drop_diags;
+    return macro_processor::string_to_macrodata(std::move(data), drop_diags);
+}
+
+// sublists are split into their components only when a component is accessed
+context::macro_data_ptr to_macrodata(std::string data, diagnostic_adder& add_diags)
+{
+    if (data.size() < 2 || data.size() > std::numeric_limits<context::A_t>::max() || data.front() != '('
+        || data.back() != ')')
+        return macro_processor::string_to_macrodata(std::move(data), add_diags);
+
+    return std::make_unique<context::macro_param_data_deferred>(std::move(data), &parse_deferred_macrodata);
+}
+
 bool has_keyword_operand(const std::unordered_map<context::id_index, const context::macro_param_base*>& named_params,
     context::id_index arg_name)
 {
@@ -321,15 +337,15 @@ context::macro_data_ptr create_macro_data_inner(semantics::concat_chain::const_i
     if (size == 0)
         return std::make_unique<context::macro_param_data_dummy>();
     else if (size == 1 && !semantics::concat_chain_matches<semantics::sublist_conc>(begin, end))
-        return macro_processor::string_to_macrodata(to_string(begin, end, add_diags), add_diags);
+        return to_macrodata(to_string(begin, end, add_diags), add_diags);
     else if (size > 1)
     {
         if (auto s = to_string(begin, end, add_diags); s.empty())
             return std::make_unique<context::macro_param_data_dummy>();
         else if (s.front() != '(' && (!nested || semantics::concatenation_point::find_var_sym(begin, end) == nullptr))
-            return macro_processor::string_to_macrodata(std::move(s), add_diags);
+            return to_macrodata(std::move(s), add_diags);
         else if (is_valid_string(s))
-            return macro_processor::string_to_macrodata(std::move(s), add_diags);
+            return to_macrodata(std::move(s), add_diags);
         else
         {
             add_diags(diagnostic_op::error_S0005);
@@ -14,12 +14,15 @@
 
 #include "preprocessor.h"
 
+#include <algorithm>
 #include <iterator>
+#include <variant>
 
 #include "lexing/logical_line.h"
 #include "protocol.h"
 #include "semantics/source_info_processor.h"
 #include "semantics/statement.h"
+#include "utils/task.h"
 #include "utils/unicode_text.h"
 
 namespace hlasm_plugin::parser_library::processing {
@@ -115,12 +118,12 @@ void preprocessor::do_highlighting(const semantics::preprocessor_statement_si& s
     }
 }
 
-void preprocessor::append_included_member(std::unique_ptr<included_member_details> details)
+void preprocessor::append_included_member(std::shared_ptr<const included_member_details> details)
 {
     m_inc_members.emplace_back(std::move(details));
 }
 
-void preprocessor::append_included_members(std::vector<std::unique_ptr<included_member_details>> details)
+void preprocessor::append_included_members(std::vector<std::shared_ptr<const included_member_details>> details)
 {
     m_inc_members.insert(
         m_inc_members.end(), std::make_move_iterator(details.begin()), std::make_move_iterator(details.end()));
@@ -131,9 +134,65 @@ void preprocessor::capture_included_members(preprocessor& preproc)
     append_included_members(std::move(preproc.m_inc_members));
 }
 
-const std::vector<std::unique_ptr<preprocessor::included_member_details>>& preprocessor::view_included_members()
+const std::vector<std::shared_ptr<const preprocessor::included_member_details>>& preprocessor::view_included_members()
 {
     return m_inc_members;
 }
 
+namespace {
+struct combined_preprocessor final : preprocessor
+{
+    std::vector<std::unique_ptr<preprocessor>> pp;
+
+    [[nodiscard]] utils::value_task<document> generate_replacement(document doc) override
+    {
+        reset();
+
+        for (const auto& p : pp)
+            doc = co_await p->generate_replacement(std::move(doc));
+
+        co_return doc;
+    }
+
+    std::vector<std::shared_ptr<semantics::preprocessor_statement_si>> take_statements() override
+    {
+        for (const auto& p : pp)
+            set_statements(p->take_statements());
+
+        return preprocessor::take_statements();
+    }
+
+    const std::vector<std::shared_ptr<const included_member_details>>& view_included_members() override
+    {
+        for (const auto& p : pp)
+            capture_included_members(*p);
+
+        return preprocessor::view_included_members();
+    }
+};
+} // namespace
+
+std::unique_ptr<preprocessor> preprocessor::create(std::span<const preprocessor_options> options,
+    library_fetcher libs,
+    diagnostic_consumer_t<diagnostic_op>* diags,
+    semantics::source_info_processor& src_proc)
+{
+    const auto transform_preprocessor = [&libs, diags, &src_proc](const preprocessor_options& po) {
+        return std::visit(
+            [&libs, diags, &src_proc](const auto& p) -> std::unique_ptr<preprocessor> {
+                return preprocessor::create(p, libs, diags, src_proc);
+            },
+            po);
+    };
+    if (options.empty())
+        return {};
+    else if (options.size() == 1)
+        return transform_preprocessor(options.front());
+
+    auto result = std::make_unique<combined_preprocessor>();
+    std::ranges::transform(options, std::back_inserter(result->pp), transform_preprocessor);
+
+    return result;
+}
+
 } // namespace hlasm_plugin::parser_library::processing
@@ -19,19 +19,17 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
 #include "document.h"
+#include "preprocessor_options.h"
 #include "utils/resource_location.h"
 
 namespace hlasm_plugin::parser_library {
-struct cics_preprocessor_options;
-struct db2_preprocessor_options;
-struct endevor_preprocessor_options;
-
 template<typename T>
 class diagnostic_consumer_t;
 struct diagnostic_op;
@@ -90,9 +88,15 @@ public:
         diagnostic_consumer_t<diagnostic_op>*,
         semantics::source_info_processor&);
 
+    // Chains the preprocessors in the order given, returns nullptr when there is none
+    static std::unique_ptr<preprocessor> create(std::span<const preprocessor_options>,
+        library_fetcher,
+        diagnostic_consumer_t<diagnostic_op>*,
+        semantics::source_info_processor&);
+
     virtual std::vector<std::shared_ptr<semantics::preprocessor_statement_si>> take_statements();
 
-    virtual const std::vector<std::unique_ptr<included_member_details>>& view_included_members();
+    virtual const std::vector<std::shared_ptr<const included_member_details>>& view_included_members();
 
     static line_iterator extract_nonempty_logical_line(lexing::logical_line<std::string_view::iterator>& out,
         line_iterator it,
@@ -119,13 +123,13 @@ protected:
         semantics::source_info_processor& src_proc,
         size_t continue_column = 15) const;
 
-    void append_included_member(std::unique_ptr<included_member_details> details);
-    void append_included_members(std::vector<std::unique_ptr<included_member_details>> details);
+    void append_included_member(std::shared_ptr<const included_member_details> details);
+    void append_included_members(std::vector<std::shared_ptr<const included_member_details>> details);
     void capture_included_members(preprocessor& preproc);
 
 private:
     std::vector<std::shared_ptr<semantics::preprocessor_statement_si>> m_statements;
-    std::vector<std::unique_ptr<included_member_details>> m_inc_members;
+    std::vector<std::shared_ptr<const included_member_details>> m_inc_members;
 };
 } // namespace hlasm_plugin::parser_library::processing
 
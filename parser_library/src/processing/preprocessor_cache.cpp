@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "preprocessor_cache.h"
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "diagnostic_consumer.h"
+#include "protocol.h"
+#include "semantics/source_info_processor.h"
+#include "semantics/statement.h"
+#include "utils/task.h"
+
+namespace hlasm_plugin::parser_library::processing {
+
+struct preprocessor_cache::entry
+{
+    struct library_request
+    {
+        std::string name;
+        std::optional<std::pair<size_t, utils::resource::resource_location>> result;
+
+        bool operator==(const library_request&) const = default;
+    };
+
+    size_t text_hash;
+    std::string text;
+    std::vector<preprocessor_options> options;
+    std::vector<library_request> requests;
+
+    // original lines refer to the text above, the rest either to the included members or to the lines themselves
+    std::vector<document_line> lines;
+    std::vector<std::shared_ptr<semantics::preprocessor_statement_si>> statements;
+    std::vector<std::shared_ptr<const preprocessor::included_member_details>> members;
+    std::vector<diagnostic_op> diags;
+    semantics::lines_info hl_tokens;
+
+    size_t memory_usage() const noexcept
+    {
+        size_t result = sizeof(*this) + text.capacity() + lines.capacity() * sizeof(document_line)
+            + requests.capacity() * sizeof(library_request) + diags.capacity() * sizeof(diagnostic_op)
+            + hl_tokens.capacity() * sizeof(token_info);
+        for (const auto& m : members)
+            result += sizeof(*m) + m->text.capacity();
+        return result;
+    }
+};
+
+class preprocessor_cache::cached_preprocessor final : public preprocessor
+{
+    std::shared_ptr<preprocessor_cache> m_cache;
+    std::vector<preprocessor_options> m_options;
+    library_fetcher m_libs;
+    diagnostic_op_consumer* m_diags;
+    semantics::source_info_processor& m_src_proc;
+
+    std::shared_ptr<const entry> m_entry;
+    std::vector<entry::library_request> m_requests;
+
+    [[nodiscard]] utils::value_task<std::optional<std::pair<std::string, utils::resource::resource_location>>> fetch(
+        std::string name)
+    {
+        std::optional<std::pair<std::string, utils::resource::resource_location>> result;
+        if (m_libs)
+            result = co_await m_libs(name);
+
+        auto& request = m_requests.emplace_back();
+        request.name = std::move(name);
+        if (result)
+            request.result.emplace(std::hash<std::string_view>()(result->first), result->second);
+
+        co_return result;
+    }
+
+    [[nodiscard]] utils::value_task<bool> members_unchanged(const entry& e)
+    {
+        m_requests.clear();
+        for (const auto& r : e.requests)
+        {
+            co_await fetch(r.name);
+            if (m_requests.back() != r)
+                co_return false;
+        }
+        co_return true;
+    }
+
+    [[nodiscard]] utils::value_task<std::shared_ptr<const entry>> preprocess(
+        std::string_view text, size_t text_hash, document doc)
+    {
+        auto e = std::make_shared<entry>();
+        e->text_hash = text_hash;
+        e->text = text;
+        e->options = m_options;
+
+        diagnostic_op_consumer_container diags;
+        semantics::source_info_processor src_proc(true);
+        auto pp = preprocessor::create(
+            m_options, std::bind_front(&cached_preprocessor::fetch, this), &diags, src_proc);
+
+        m_requests.clear();
+        const auto result = co_await pp->generate_replacement(std::move(doc));
+
+        e->requests = std::move(m_requests);
+        e->lines.reserve(result.size());
+        for (const auto& line : result)
+        {
+            if (line.is_original())
+                e->lines.emplace_back(original_line {
+                    std::string_view(e->text).substr(line.text().data() - text.data(), line.text().size()),
+                    *line.lineno(),
+                });
+            else
+                e->lines.push_back(line);
+        }
+        e->statements = pp->take_statements();
+        e->members = pp->view_included_members();
+        e->diags = std::move(diags.diags);
+        e->hl_tokens = src_proc.take_semantic_tokens();
+
+        co_return e;
+    }
+
+    // Returns the text covered by the lines, provided they are the unmodified and contiguous lines of the program
+    static std::optional<std::string_view> source_text(const document& doc)
+    {
+        if (doc.size() == 0)
+            return std::string_view();
+
+        const char* const begin = doc.begin()->text().data();
+        const char* end = begin;
+        for (const auto& line : doc)
+        {
+            if (!line.is_original() || (line.text().data() != end && !line.text().empty()))
+                return std::nullopt;
+            end += line.text().size();
+        }
+        return std::string_view(begin, end - begin);
+    }
+
+    document replay(std::string_view text)
+    {
+        const auto& e = *m_entry;
+
+        if (m_diags)
+        {
+            for (const auto& d : e.diags)
+                m_diags->add_diagnostic(d);
+        }
+        for (const auto& t : e.hl_tokens)
+            m_src_proc.add_hl_symbol(t);
+
+        set_statements(e.statements);
+        append_included_members(e.members);
+
+        std::vector<document_line> lines;
+        lines.reserve(e.lines.size());
+        for (const auto& line : e.lines)
+        {
+            if (line.is_original())
+                lines.emplace_back(original_line {
+                    text.substr(line.text().data() - e.text.data(), line.text().size()),
+                    *line.lineno(),
+                });
+            else
+                lines.emplace_back(borrowed_line { line.text() });
+        }
+
+        return document(std::move(lines));
+    }
+
+public:
+    cached_preprocessor(std::shared_ptr<preprocessor_cache> cache,
+        std::vector<preprocessor_options> options,
+        library_fetcher libs,
+        diagnostic_op_consumer* diags,
+        semantics::source_info_processor& src_proc)
+        : m_cache(std::move(cache))
+        , m_options(std::move(options))
+        , m_libs(std::move(libs))
+        , m_diags(diags)
+        , m_src_proc(src_proc)
+    {}
+
+    [[nodiscard]] utils::value_task<document> generate_replacement(document doc) override
+    {
+        reset();
+        m_entry.reset();
+
+        const auto text = source_text(doc);
+        if (!text)
+        {
+            // not the program itself, nothing to compare to
+            auto pp = preprocessor::create(m_options, m_libs, m_diags, m_src_proc);
+            auto result = co_await pp->generate_replacement(std::move(doc));
+            set_statements(pp->take_statements());
+            append_included_members(pp->view_included_members());
+            co_return result;
+        }
+
+        const auto text_hash = std::hash<std::string_view>()(*text);
+        if (auto last = m_cache->m_last; last && last->text_hash == text_hash && last->text == *text
+            && last->options == m_options && co_await members_unchanged(*last))
+            m_entry = last;
+        else
+            m_cache->m_last = m_entry = co_await preprocess(*text, text_hash, std::move(doc));
+
+        co_return replay(*text);
+    }
+};
+
+preprocessor_cache::preprocessor_cache() noexcept = default;
+preprocessor_cache::~preprocessor_cache() = default;
+
+void preprocessor_cache::clear() noexcept { m_last.reset(); }
+
+size_t preprocessor_cache::memory_usage() const noexcept { return m_last ? m_last->memory_usage() : 0; }
+
+std::unique_ptr<preprocessor> preprocessor_cache::create_preprocessor(std::shared_ptr<preprocessor_cache> cache,
+    std::vector<preprocessor_options> options,
+    library_fetcher libs,
+    diagnostic_consumer_t<diagnostic_op>* diags,
+    semantics::source_info_processor& src_proc)
+{
+    if (options.empty())
+        return {};
+
+    return std::make_unique<cached_preprocessor>(
+        std::move(cache), std::move(options), std::move(libs), diags, src_proc);
+}
+
+} // namespace hlasm_plugin::parser_library::processing
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPARSER_PARSERLIBRARY_PROCESSING_PREPROCESSOR_CACHE_H
+#define HLASMPARSER_PARSERLIBRARY_PROCESSING_PREPROCESSOR_CACHE_H
+
+#include <memory>
+#include <vector>
+
+#include "preprocessor.h"
+#include "preprocessor_options.h"
+
+namespace hlasm_plugin::parser_library::processing {
+
+// Keeps the outcome of the last preprocessing of a program.
+// The outcome is replayed as long as the text, the preprocessor options and all the fetched members stay the same.
+class preprocessor_cache
+{
+    struct entry;
+    class cached_preprocessor;
+
+    std::shared_ptr<const entry> m_last;
+
+public:
+    preprocessor_cache() noexcept;
+    ~preprocessor_cache();
+
+    void clear() noexcept;
+
+    size_t memory_usage() const noexcept;
+
+    // Wraps the preprocessors described by options, returns nullptr when there is none
+    static std::unique_ptr<preprocessor> create_preprocessor(std::shared_ptr<preprocessor_cache> cache,
+        std::vector<preprocessor_options> options,
+        library_fetcher libs,
+        diagnostic_consumer_t<diagnostic_op>* diags,
+        semantics::source_info_processor& src_proc);
+};
+
+} // namespace hlasm_plugin::parser_library::processing
+
+#endif
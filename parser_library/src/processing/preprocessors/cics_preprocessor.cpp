@@ -880,8 +880,8 @@ public:
 
     void inject_no_end_warning()
     {
-        m_result.emplace_back(replaced_line { "*DFH7041I W  NO END CARD FOUND - COPYBOOK ASSUMED.\n" });
-        m_result.emplace_back(replaced_line { "         DFHEIMSG 4\n" });
+        m_result.emplace_back(borrowed_line { "*DFH7041I W  NO END CARD FOUND - COPYBOOK ASSUMED.\n" });
+        m_result.emplace_back(borrowed_line { "         DFHEIMSG 4\n" });
     }
 
     void inject_DFHEIGBL(bool rsect)
@@ -889,43 +889,43 @@ public:
         if (rsect)
         {
             if (m_options.leasm)
-                m_result.emplace_back(replaced_line { "         DFHEIGBL ,,RS,LE          INSERTED BY TRANSLATOR\n" });
+                m_result.emplace_back(borrowed_line { "         DFHEIGBL ,,RS,LE          INSERTED BY TRANSLATOR\n" });
             else
-                m_result.emplace_back(replaced_line { "         DFHEIGBL ,,RS,NOLE        INSERTED BY TRANSLATOR\n" });
+                m_result.emplace_back(borrowed_line { "         DFHEIGBL ,,RS,NOLE        INSERTED BY TRANSLATOR\n" });
         }
         else
         {
             if (m_options.leasm)
-                m_result.emplace_back(replaced_line { "         DFHEIGBL ,,,LE            INSERTED BY TRANSLATOR\n" });
+                m_result.emplace_back(borrowed_line { "         DFHEIGBL ,,,LE            INSERTED BY TRANSLATOR\n" });
             else
-                m_result.emplace_back(replaced_line { "         DFHEIGBL ,,,NOLE          INSERTED BY TRANSLATOR\n" });
+                m_result.emplace_back(borrowed_line { "         DFHEIGBL ,,,NOLE          INSERTED BY TRANSLATOR\n" });
         }
     }
 
     void inject_prolog()
     {
-        m_result.emplace_back(replaced_line { "         DFHEIENT                  INSERTED BY TRANSLATOR\n" });
+        m_result.emplace_back(borrowed_line { "         DFHEIENT                  INSERTED BY TRANSLATOR\n" });
     }
     void inject_dfh_null_error(std::string_view variable)
     {
         m_result.emplace_back(
             replaced_line { concat("*DFH7218I S  SUB-OPERAND(S) OF '", variable, "' CANNOT BE NULL. COMMAND NOT\n") });
-        m_result.emplace_back(replaced_line { "*            TRANSLATED.\n" });
-        m_result.emplace_back(replaced_line { "         DFHEIMSG 12\n" });
+        m_result.emplace_back(borrowed_line { "*            TRANSLATED.\n" });
+        m_result.emplace_back(borrowed_line { "         DFHEIMSG 12\n" });
     }
     void inject_end_code()
     {
         if (m_options.epilog)
-            m_result.emplace_back(replaced_line { "         DFHEIRET                  INSERTED BY TRANSLATOR\n" });
+            m_result.emplace_back(borrowed_line { "         DFHEIRET                  INSERTED BY TRANSLATOR\n" });
         if (m_options.prolog)
         {
-            m_result.emplace_back(replaced_line { "         DFHEISTG                  INSERTED BY TRANSLATOR\n" });
-            m_result.emplace_back(replaced_line { "         DFHEIEND                  INSERTED BY TRANSLATOR\n" });
+            m_result.emplace_back(borrowed_line { "         DFHEISTG                  INSERTED BY TRANSLATOR\n" });
+            m_result.emplace_back(borrowed_line { "         DFHEIEND                  INSERTED BY TRANSLATOR\n" });
         }
     }
     void inject_DFHEISTG()
     {
-        m_result.emplace_back(replaced_line { "         DFHEISTG                  INSERTED BY TRANSLATOR\n" });
+        m_result.emplace_back(borrowed_line { "         DFHEISTG                  INSERTED BY TRANSLATOR\n" });
     }
 
     bool try_asm_xopts(std::string_view input, size_t lineno)
@@ -1092,7 +1092,7 @@ public:
         else
         {
             m_result.emplace_back(replaced_line { generate_label_fragment(label_b, label_e, li) });
-            m_result.emplace_back(replaced_line { "         DFHECALL =X'0E'\n" });
+            m_result.emplace_back(borrowed_line { "         DFHECALL =X'0E'\n" });
         }
         // TODO: generate correct calls
     }
@@ -1138,17 +1138,17 @@ public:
             {
                 if (m_diags)
                     m_diags->add_diagnostic(diagnostic_op::warn_CIC001(range(position(lineno, 0))));
-                m_result.emplace_back(replaced_line { "*DFH7080I W  CONTINUATION OF EXEC COMMAND IGNORED.\n" });
-                m_result.emplace_back(replaced_line { "         DFHEIMSG 4\n" });
+                m_result.emplace_back(borrowed_line { "*DFH7080I W  CONTINUATION OF EXEC COMMAND IGNORED.\n" });
+                m_result.emplace_back(borrowed_line { "         DFHEIMSG 4\n" });
             }
         }
         else
         {
             if (m_diags)
                 m_diags->add_diagnostic(diagnostic_op::warn_CIC003(range(position(lineno, 0))));
-            m_result.emplace_back(replaced_line { "*DFH7237I S  INCORRECT SYNTAX AFTER 'EXEC CICS'. COMMAND NOT\n" });
-            m_result.emplace_back(replaced_line { "*            TRANSLATED.\n" });
-            m_result.emplace_back(replaced_line { "         DFHEIMSG 12\n" });
+            m_result.emplace_back(borrowed_line { "*DFH7237I S  INCORRECT SYNTAX AFTER 'EXEC CICS'. COMMAND NOT\n" });
+            m_result.emplace_back(borrowed_line { "*            TRANSLATED.\n" });
+            m_result.emplace_back(borrowed_line { "         DFHEIMSG 12\n" });
         }
 
         if (potential_lineno)
@@ -347,14 +347,14 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
         constexpr auto version_chunk = (size_t)32;
         if (m_version.size() <= version_chunk)
         {
-            m_result.emplace_back(replaced_line { "SQLVERSP DC    CL4'VER.' VERSION-ID PREFIX\n" });
+            m_result.emplace_back(borrowed_line { "SQLVERSP DC    CL4'VER.' VERSION-ID PREFIX\n" });
             m_result.emplace_back(replaced_line { concat("SQLVERD1 DC    CL64'", m_version, "'        VERSION-ID\n") });
         }
         else
         {
-            m_result.emplace_back(replaced_line { "SQLVERS  DS    CL68      VERSION-ID\n" });
-            m_result.emplace_back(replaced_line { "         ORG   SQLVERS+0\n" });
-            m_result.emplace_back(replaced_line { "SQLVERSP DC    CL4'VER.' VERS-ID PREFIX\n" });
+            m_result.emplace_back(borrowed_line { "SQLVERS  DS    CL68      VERSION-ID\n" });
+            m_result.emplace_back(borrowed_line { "         ORG   SQLVERS+0\n" });
+            m_result.emplace_back(borrowed_line { "SQLVERSP DC    CL4'VER.' VERS-ID PREFIX\n" });
 
             for (auto [version, i] = std::pair(std::string_view(m_version), 1); !version.empty();
                 version.remove_prefix(std::min(version.size(), version_chunk)), ++i)
@@ -376,119 +376,119 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
         if (!m_version.empty())
             push_sql_version_data();
 
-        m_result.emplace_back(replaced_line { "***$$$ SQL WORKING STORAGE                      \n" });
-        m_result.emplace_back(replaced_line { "SQLDSIZ  DC    A(SQLDLEN) SQLDSECT SIZE         \n" });
-        m_result.emplace_back(replaced_line { "SQLDSECT DSECT                                  \n" });
-        m_result.emplace_back(replaced_line { "SQLTEMP  DS    CL128     TEMPLATE               \n" });
-        m_result.emplace_back(replaced_line { "DSNTEMP  DS    F         INT SCROLL VALUE       \n" });
-        m_result.emplace_back(replaced_line { "DSNTMP2  DS    PL16      DEC SCROLL VALUE       \n" });
-        m_result.emplace_back(replaced_line { "DSNNROWS DS    F         MULTI-ROW N-ROWS VALUE \n" });
-        m_result.emplace_back(replaced_line { "DSNNTYPE DS    H         MULTI-ROW N-ROWS TYPE  \n" });
-        m_result.emplace_back(replaced_line { "DSNNLEN  DS    H         MULTI-ROW N-ROWS LENGTH\n" });
-        m_result.emplace_back(replaced_line { "DSNPARMS DS    4F        DSNHMLTR PARM LIST     \n" });
-        m_result.emplace_back(replaced_line { "DSNPNM   DS    CL386     PROCEDURE NAME         \n" });
-        m_result.emplace_back(replaced_line { "DSNCNM   DS    CL128     CURSOR NAME            \n" });
-        m_result.emplace_back(replaced_line { "SQL_FILE_READ      EQU 2                        \n" });
-        m_result.emplace_back(replaced_line { "SQL_FILE_CREATE    EQU 8                        \n" });
-        m_result.emplace_back(replaced_line { "SQL_FILE_OVERWRITE EQU 16                       \n" });
-        m_result.emplace_back(replaced_line { "SQL_FILE_APPEND    EQU 32                       \n" });
-        m_result.emplace_back(replaced_line { "         DS    0D                               \n" });
-        m_result.emplace_back(replaced_line { "SQLPLIST DS    F                                \n" });
-        m_result.emplace_back(replaced_line { "SQLPLLEN DS    H         PLIST LENGTH           \n" });
-        m_result.emplace_back(replaced_line { "SQLFLAGS DS    XL2       FLAGS                  \n" });
-        m_result.emplace_back(replaced_line { "SQLCTYPE DS    H         CALL-TYPE              \n" });
-        m_result.emplace_back(replaced_line { "SQLPROGN DS    CL8       PROGRAM NAME           \n" });
-        m_result.emplace_back(replaced_line { "SQLTIMES DS    CL8       TIMESTAMP              \n" });
-        m_result.emplace_back(replaced_line { "SQLSECTN DS    H         SECTION                \n" });
-        m_result.emplace_back(replaced_line { "SQLCODEP DS    A         CODE POINTER           \n" });
-        m_result.emplace_back(replaced_line { "SQLVPARM DS    A         VPARAM POINTER         \n" });
-        m_result.emplace_back(replaced_line { "SQLAPARM DS    A         AUX PARAM PTR          \n" });
-        m_result.emplace_back(replaced_line { "SQLSTNM7 DS    H         PRE_V8 STATEMENT NUMBER\n" });
-        m_result.emplace_back(replaced_line { "SQLSTYPE DS    H         STATEMENT TYPE         \n" });
-        m_result.emplace_back(replaced_line { "SQLSTNUM DS    F         STATEMENT NUMBER       \n" });
-        m_result.emplace_back(replaced_line { "SQLFLAG2 DS    H         internal flags         \n" });
-        m_result.emplace_back(replaced_line { "SQLRSRVD DS    CL18      RESERVED               \n" });
-        m_result.emplace_back(replaced_line { "SQLPVARS DS    CL8,F,2H,0CL44                   \n" });
-        m_result.emplace_back(replaced_line { "SQLAVARS DS    CL8,F,2H,0CL44                   \n" });
-        m_result.emplace_back(replaced_line { "         DS    0D                               \n" });
-        m_result.emplace_back(replaced_line { "SQLDLEN  EQU   *-SQLDSECT                       \n" });
+        m_result.emplace_back(borrowed_line { "***$$$ SQL WORKING STORAGE                      \n" });
+        m_result.emplace_back(borrowed_line { "SQLDSIZ  DC    A(SQLDLEN) SQLDSECT SIZE         \n" });
+        m_result.emplace_back(borrowed_line { "SQLDSECT DSECT                                  \n" });
+        m_result.emplace_back(borrowed_line { "SQLTEMP  DS    CL128     TEMPLATE               \n" });
+        m_result.emplace_back(borrowed_line { "DSNTEMP  DS    F         INT SCROLL VALUE       \n" });
+        m_result.emplace_back(borrowed_line { "DSNTMP2  DS    PL16      DEC SCROLL VALUE       \n" });
+        m_result.emplace_back(borrowed_line { "DSNNROWS DS    F         MULTI-ROW N-ROWS VALUE \n" });
+        m_result.emplace_back(borrowed_line { "DSNNTYPE DS    H         MULTI-ROW N-ROWS TYPE  \n" });
+        m_result.emplace_back(borrowed_line { "DSNNLEN  DS    H         MULTI-ROW N-ROWS LENGTH\n" });
+        m_result.emplace_back(borrowed_line { "DSNPARMS DS    4F        DSNHMLTR PARM LIST     \n" });
+        m_result.emplace_back(borrowed_line { "DSNPNM   DS    CL386     PROCEDURE NAME         \n" });
+        m_result.emplace_back(borrowed_line { "DSNCNM   DS    CL128     CURSOR NAME            \n" });
+        m_result.emplace_back(borrowed_line { "SQL_FILE_READ      EQU 2                        \n" });
+        m_result.emplace_back(borrowed_line { "SQL_FILE_CREATE    EQU 8                        \n" });
+        m_result.emplace_back(borrowed_line { "SQL_FILE_OVERWRITE EQU 16                       \n" });
+        m_result.emplace_back(borrowed_line { "SQL_FILE_APPEND    EQU 32                       \n" });
+        m_result.emplace_back(borrowed_line { "         DS    0D                               \n" });
+        m_result.emplace_back(borrowed_line { "SQLPLIST DS    F                                \n" });
+        m_result.emplace_back(borrowed_line { "SQLPLLEN DS    H         PLIST LENGTH           \n" });
+        m_result.emplace_back(borrowed_line { "SQLFLAGS DS    XL2       FLAGS                  \n" });
+        m_result.emplace_back(borrowed_line { "SQLCTYPE DS    H         CALL-TYPE              \n" });
+        m_result.emplace_back(borrowed_line { "SQLPROGN DS    CL8       PROGRAM NAME           \n" });
+        m_result.emplace_back(borrowed_line { "SQLTIMES DS    CL8       TIMESTAMP              \n" });
+        m_result.emplace_back(borrowed_line { "SQLSECTN DS    H         SECTION                \n" });
+        m_result.emplace_back(borrowed_line { "SQLCODEP DS    A         CODE POINTER           \n" });
+        m_result.emplace_back(borrowed_line { "SQLVPARM DS    A         VPARAM POINTER         \n" });
+        m_result.emplace_back(borrowed_line { "SQLAPARM DS    A         AUX PARAM PTR          \n" });
+        m_result.emplace_back(borrowed_line { "SQLSTNM7 DS    H         PRE_V8 STATEMENT NUMBER\n" });
+        m_result.emplace_back(borrowed_line { "SQLSTYPE DS    H         STATEMENT TYPE         \n" });
+        m_result.emplace_back(borrowed_line { "SQLSTNUM DS    F         STATEMENT NUMBER       \n" });
+        m_result.emplace_back(borrowed_line { "SQLFLAG2 DS    H         internal flags         \n" });
+        m_result.emplace_back(borrowed_line { "SQLRSRVD DS    CL18      RESERVED               \n" });
+        m_result.emplace_back(borrowed_line { "SQLPVARS DS    CL8,F,2H,0CL44                   \n" });
+        m_result.emplace_back(borrowed_line { "SQLAVARS DS    CL8,F,2H,0CL44                   \n" });
+        m_result.emplace_back(borrowed_line { "         DS    0D                               \n" });
+        m_result.emplace_back(borrowed_line { "SQLDLEN  EQU   *-SQLDSECT                       \n" });
     }
 
     void inject_SQLCA()
     {
-        m_result.emplace_back(replaced_line { "***$$$ SQLCA                          \n" });
-        m_result.emplace_back(replaced_line { "SQLCA    DS    0F                     \n" });
-        m_result.emplace_back(replaced_line { "SQLCAID  DS    CL8      ID            \n" });
-        m_result.emplace_back(replaced_line { "SQLCABC  DS    F        BYTE COUNT    \n" });
-        m_result.emplace_back(replaced_line { "SQLCODE  DS    F        RETURN CODE   \n" });
-        m_result.emplace_back(replaced_line { "SQLERRM  DS    H,CL70   ERR MSG PARMS \n" });
-        m_result.emplace_back(replaced_line { "SQLERRP  DS    CL8      IMPL-DEPENDENT\n" });
-        m_result.emplace_back(replaced_line { "SQLERRD  DS    6F                     \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN  DS    0C       WARNING FLAGS \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN0 DS    C'W' IF ANY            \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN1 DS    C'W' = WARNING         \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN2 DS    C'W' = WARNING         \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN3 DS    C'W' = WARNING         \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN4 DS    C'W' = WARNING         \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN5 DS    C'W' = WARNING         \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN6 DS    C'W' = WARNING         \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN7 DS    C'W' = WARNING         \n" });
-        m_result.emplace_back(replaced_line { "SQLEXT   DS    0CL8                   \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN8 DS    C                      \n" });
-        m_result.emplace_back(replaced_line { "SQLWARN9 DS    C                      \n" });
-        m_result.emplace_back(replaced_line { "SQLWARNA DS    C                      \n" });
-        m_result.emplace_back(replaced_line { "SQLSTATE DS    CL5                    \n" });
-        m_result.emplace_back(replaced_line { "***$$$\n" });
+        m_result.emplace_back(borrowed_line { "***$$$ SQLCA                          \n" });
+        m_result.emplace_back(borrowed_line { "SQLCA    DS    0F                     \n" });
+        m_result.emplace_back(borrowed_line { "SQLCAID  DS    CL8      ID            \n" });
+        m_result.emplace_back(borrowed_line { "SQLCABC  DS    F        BYTE COUNT    \n" });
+        m_result.emplace_back(borrowed_line { "SQLCODE  DS    F        RETURN CODE   \n" });
+        m_result.emplace_back(borrowed_line { "SQLERRM  DS    H,CL70   ERR MSG PARMS \n" });
+        m_result.emplace_back(borrowed_line { "SQLERRP  DS    CL8      IMPL-DEPENDENT\n" });
+        m_result.emplace_back(borrowed_line { "SQLERRD  DS    6F                     \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN  DS    0C       WARNING FLAGS \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN0 DS    C'W' IF ANY            \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN1 DS    C'W' = WARNING         \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN2 DS    C'W' = WARNING         \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN3 DS    C'W' = WARNING         \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN4 DS    C'W' = WARNING         \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN5 DS    C'W' = WARNING         \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN6 DS    C'W' = WARNING         \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN7 DS    C'W' = WARNING         \n" });
+        m_result.emplace_back(borrowed_line { "SQLEXT   DS    0CL8                   \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN8 DS    C                      \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARN9 DS    C                      \n" });
+        m_result.emplace_back(borrowed_line { "SQLWARNA DS    C                      \n" });
+        m_result.emplace_back(borrowed_line { "SQLSTATE DS    CL5                    \n" });
+        m_result.emplace_back(borrowed_line { "***$$$\n" });
     }
     void inject_SQLDA()
     {
-        m_result.emplace_back(replaced_line { "***$$$ SQLDA                                            \n" });
-        m_result.emplace_back(replaced_line { "SQLTRIPL EQU    C'3'                                    \n" });
-        m_result.emplace_back(replaced_line { "SQLDOUBL EQU    C'2'                                    \n" });
-        m_result.emplace_back(replaced_line { "SQLSINGL EQU    C' '                                    \n" });
-        m_result.emplace_back(replaced_line { "*                                                       \n" });
-        m_result.emplace_back(replaced_line { "         SQLSECT SAVE                                   \n" });
-        m_result.emplace_back(replaced_line { "*                                                       \n" });
-        m_result.emplace_back(replaced_line { "SQLDA    DSECT                                          \n" });
-        m_result.emplace_back(replaced_line { "SQLDAID  DS    CL8      ID                              \n" });
-        m_result.emplace_back(replaced_line { "SQLDABC  DS    F        BYTE COUNT                      \n" });
-        m_result.emplace_back(replaced_line { "SQLN     DS    H        COUNT SQLVAR/SQLVAR2 ENTRIES    \n" });
-        m_result.emplace_back(replaced_line { "SQLD     DS    H        COUNT VARS (TWICE IF USING BOTH)\n" });
-        m_result.emplace_back(replaced_line { "*                                                       \n" });
-        m_result.emplace_back(replaced_line { "SQLVAR   DS    0F       BEGIN VARS                      \n" });
-        m_result.emplace_back(replaced_line { "SQLVARN  DSECT ,        NTH VARIABLE                    \n" });
-        m_result.emplace_back(replaced_line { "SQLTYPE  DS    H        DATA TYPE CODE                  \n" });
-        m_result.emplace_back(replaced_line { "SQLLEN   DS    0H       LENGTH                          \n" });
-        m_result.emplace_back(replaced_line { "SQLPRCSN DS    X        DEC PRECISION                   \n" });
-        m_result.emplace_back(replaced_line { "SQLSCALE DS    X        DEC SCALE                       \n" });
-        m_result.emplace_back(replaced_line { "SQLDATA  DS    A        ADDR OF VAR                     \n" });
-        m_result.emplace_back(replaced_line { "SQLIND   DS    A        ADDR OF IND                     \n" });
-        m_result.emplace_back(replaced_line { "SQLNAME  DS    H,CL30   DESCRIBE NAME                   \n" });
-        m_result.emplace_back(replaced_line { "SQLVSIZ  EQU   *-SQLDATA                                \n" });
-        m_result.emplace_back(replaced_line { "SQLSIZV  EQU   *-SQLVARN                                \n" });
-        m_result.emplace_back(replaced_line { "*                                                       \n" });
-        m_result.emplace_back(replaced_line { "SQLDA    DSECT                                          \n" });
-        m_result.emplace_back(replaced_line { "SQLVAR2  DS     0F      BEGIN EXTENDED FIELDS OF VARS   \n" });
-        m_result.emplace_back(replaced_line { "SQLVAR2N DSECT  ,       EXTENDED FIELDS OF NTH VARIABLE \n" });
-        m_result.emplace_back(replaced_line { "SQLLONGL DS     F       LENGTH                          \n" });
-        m_result.emplace_back(replaced_line { "SQLRSVDL DS     F       RESERVED                        \n" });
-        m_result.emplace_back(replaced_line { "SQLDATAL DS     A       ADDR OF LENGTH IN BYTES         \n" });
-        m_result.emplace_back(replaced_line { "SQLTNAME DS     H,CL30  DESCRIBE NAME                   \n" });
-        m_result.emplace_back(replaced_line { "*                                                       \n" });
-        m_result.emplace_back(replaced_line { "         SQLSECT RESTORE                                \n" });
-        m_result.emplace_back(replaced_line { "***$$$\n" });
+        m_result.emplace_back(borrowed_line { "***$$$ SQLDA                                            \n" });
+        m_result.emplace_back(borrowed_line { "SQLTRIPL EQU    C'3'                                    \n" });
+        m_result.emplace_back(borrowed_line { "SQLDOUBL EQU    C'2'                                    \n" });
+        m_result.emplace_back(borrowed_line { "SQLSINGL EQU    C' '                                    \n" });
+        m_result.emplace_back(borrowed_line { "*                                                       \n" });
+        m_result.emplace_back(borrowed_line { "         SQLSECT SAVE                                   \n" });
+        m_result.emplace_back(borrowed_line { "*                                                       \n" });
+        m_result.emplace_back(borrowed_line { "SQLDA    DSECT                                          \n" });
+        m_result.emplace_back(borrowed_line { "SQLDAID  DS    CL8      ID                              \n" });
+        m_result.emplace_back(borrowed_line { "SQLDABC  DS    F        BYTE COUNT                      \n" });
+        m_result.emplace_back(borrowed_line { "SQLN     DS    H        COUNT SQLVAR/SQLVAR2 ENTRIES    \n" });
+        m_result.emplace_back(borrowed_line { "SQLD     DS    H        COUNT VARS (TWICE IF USING BOTH)\n" });
+        m_result.emplace_back(borrowed_line { "*                                                       \n" });
+        m_result.emplace_back(borrowed_line { "SQLVAR   DS    0F       BEGIN VARS                      \n" });
+        m_result.emplace_back(borrowed_line { "SQLVARN  DSECT ,        NTH VARIABLE                    \n" });
+        m_result.emplace_back(borrowed_line { "SQLTYPE  DS    H        DATA TYPE CODE                  \n" });
+        m_result.emplace_back(borrowed_line { "SQLLEN   DS    0H       LENGTH                          \n" });
+        m_result.emplace_back(borrowed_line { "SQLPRCSN DS    X        DEC PRECISION                   \n" });
+        m_result.emplace_back(borrowed_line { "SQLSCALE DS    X        DEC SCALE                       \n" });
+        m_result.emplace_back(borrowed_line { "SQLDATA  DS    A        ADDR OF VAR                     \n" });
+        m_result.emplace_back(borrowed_line { "SQLIND   DS    A        ADDR OF IND                     \n" });
+        m_result.emplace_back(borrowed_line { "SQLNAME  DS    H,CL30   DESCRIBE NAME                   \n" });
+        m_result.emplace_back(borrowed_line { "SQLVSIZ  EQU   *-SQLDATA                                \n" });
+        m_result.emplace_back(borrowed_line { "SQLSIZV  EQU   *-SQLVARN                                \n" });
+        m_result.emplace_back(borrowed_line { "*                                                       \n" });
+        m_result.emplace_back(borrowed_line { "SQLDA    DSECT                                          \n" });
+        m_result.emplace_back(borrowed_line { "SQLVAR2  DS     0F      BEGIN EXTENDED FIELDS OF VARS   \n" });
+        m_result.emplace_back(borrowed_line { "SQLVAR2N DSECT  ,       EXTENDED FIELDS OF NTH VARIABLE \n" });
+        m_result.emplace_back(borrowed_line { "SQLLONGL DS     F       LENGTH                          \n" });
+        m_result.emplace_back(borrowed_line { "SQLRSVDL DS     F       RESERVED                        \n" });
+        m_result.emplace_back(borrowed_line { "SQLDATAL DS     A       ADDR OF LENGTH IN BYTES         \n" });
+        m_result.emplace_back(borrowed_line { "SQLTNAME DS     H,CL30  DESCRIBE NAME                   \n" });
+        m_result.emplace_back(borrowed_line { "*                                                       \n" });
+        m_result.emplace_back(borrowed_line { "         SQLSECT RESTORE                                \n" });
+        m_result.emplace_back(borrowed_line { "***$$$\n" });
     }
     void inject_SQLSECT()
     {
-        m_result.emplace_back(replaced_line { "         MACRO                          \n" });
-        m_result.emplace_back(replaced_line { "         SQLSECT &TYPE                  \n" });
-        m_result.emplace_back(replaced_line { "         GBLC  &SQLSECT                 \n" });
-        m_result.emplace_back(replaced_line { "         AIF ('&TYPE' EQ 'RESTORE').REST\n" });
-        m_result.emplace_back(replaced_line { "&SQLSECT SETC  '&SYSECT'                \n" });
-        m_result.emplace_back(replaced_line { "         MEXIT                          \n" });
-        m_result.emplace_back(replaced_line { ".REST    ANOP                           \n" });
-        m_result.emplace_back(replaced_line { "&SQLSECT CSECT                          \n" });
-        m_result.emplace_back(replaced_line { "         MEND                           \n" });
+        m_result.emplace_back(borrowed_line { "         MACRO                          \n" });
+        m_result.emplace_back(borrowed_line { "         SQLSECT &TYPE                  \n" });
+        m_result.emplace_back(borrowed_line { "         GBLC  &SQLSECT                 \n" });
+        m_result.emplace_back(borrowed_line { "         AIF ('&TYPE' EQ 'RESTORE').REST\n" });
+        m_result.emplace_back(borrowed_line { "&SQLSECT SETC  '&SYSECT'                \n" });
+        m_result.emplace_back(borrowed_line { "         MEXIT                          \n" });
+        m_result.emplace_back(borrowed_line { ".REST    ANOP                           \n" });
+        m_result.emplace_back(borrowed_line { "&SQLSECT CSECT                          \n" });
+        m_result.emplace_back(borrowed_line { "         MEND                           \n" });
     }
 
     template<typename It>
@@ -556,7 +556,7 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
             inject_SQLDA();
             co_return { instruction_type, member_upper };
         }
-        m_result.emplace_back(replaced_line { "***$$$\n" });
+        m_result.emplace_back(borrowed_line { "***$$$\n" });
 
         std::optional<std::pair<std::string, utils::resource::resource_location>> include_member;
         if (m_libs)
@@ -569,11 +569,12 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
         }
 
         auto& [include_mem_text, include_mem_loc] = *include_member;
-        document d(include_mem_text);
-        d.convert_to_replaced();
+        auto details = std::make_unique<included_member_details>(included_member_details {
+            std::move(member_upper), std::move(include_mem_text), std::move(include_mem_loc) });
+        document d(details->text);
+        d.convert_to_borrowed();
         co_await generate_replacement(d.begin(), d.end(), m_ll_include_helper, false);
-        append_included_member(std::make_unique<included_member_details>(included_member_details {
-            std::move(member_upper), std::move(include_mem_text), std::move(include_mem_loc) }));
+        append_included_member(std::move(details));
         co_return { line_type::include, member };
     }
 
@@ -849,7 +850,7 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
         if (!label.empty())
             m_result.emplace_back(replaced_line { concat(label, " DS 0H\n") });
 
-        m_result.emplace_back(replaced_line { "***$$$\n" });
+        m_result.emplace_back(borrowed_line { "***$$$\n" });
 
         bool first_line = true;
         for (const auto& segment : ll_segments)
@@ -879,11 +880,11 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
                 diags->add_diagnostic(std::move(diag));
         };
 
-        m_result.emplace_back(replaced_line { "***$$$\n" });
+        m_result.emplace_back(borrowed_line { "***$$$\n" });
         m_result.emplace_back(replaced_line { concat("*",
             std::string_view(ll.m_orig_ll.segments.front().code, ll.m_orig_ll.segments.front().continuation),
             "\n") });
-        m_result.emplace_back(replaced_line { "***$$$\n" });
+        m_result.emplace_back(borrowed_line { "***$$$\n" });
 
         // DB2 preprocessor exhibits strange behavior when SQL TYPE line is continued
         if (ll.m_db2_ll.segments.size() > 1)
@@ -956,51 +957,51 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
     {
         // this function generates semi-realistic sql statement replacement code, because people do strange things...
         // <arguments> input parameters
-        m_result.emplace_back(replaced_line { "         BRAS  15,*+56                     \n" });
-        m_result.emplace_back(replaced_line { "         DC    H'0',X'0000',H'0'           \n" });
-        m_result.emplace_back(replaced_line { "         DC    XL8'0000000000000000'       \n" });
-        m_result.emplace_back(replaced_line { "         DC    XL8'0000000000000000',H'0'  \n" });
-        m_result.emplace_back(replaced_line { "         DC    H'0,0,0',X'0000',H'0',9H'0' \n" });
-        m_result.emplace_back(replaced_line { "         MVC   SQLPLLEN(24),0(15)          \n" });
-        m_result.emplace_back(replaced_line { "         MVC   SQLSTNM7(28),24(15)         \n" });
-        m_result.emplace_back(replaced_line { "         LA    15,SQLCA                    \n" });
-        m_result.emplace_back(replaced_line { "         ST    15,SQLCODEP                 \n" });
+        m_result.emplace_back(borrowed_line { "         BRAS  15,*+56                     \n" });
+        m_result.emplace_back(borrowed_line { "         DC    H'0',X'0000',H'0'           \n" });
+        m_result.emplace_back(borrowed_line { "         DC    XL8'0000000000000000'       \n" });
+        m_result.emplace_back(borrowed_line { "         DC    XL8'0000000000000000',H'0'  \n" });
+        m_result.emplace_back(borrowed_line { "         DC    H'0,0,0',X'0000',H'0',9H'0' \n" });
+        m_result.emplace_back(borrowed_line { "         MVC   SQLPLLEN(24),0(15)          \n" });
+        m_result.emplace_back(borrowed_line { "         MVC   SQLSTNM7(28),24(15)         \n" });
+        m_result.emplace_back(borrowed_line { "         LA    15,SQLCA                    \n" });
+        m_result.emplace_back(borrowed_line { "         ST    15,SQLCODEP                 \n" });
 
         if (in_params == 0)
         {
-            m_result.emplace_back(replaced_line { "         MVC   SQLVPARM,=XL4'00000000'     \n" });
+            m_result.emplace_back(borrowed_line { "         MVC   SQLVPARM,=XL4'00000000'     \n" });
         }
         else
         {
-            m_result.emplace_back(replaced_line { "         LA    14,SQLPVARS+16              \n" });
+            m_result.emplace_back(borrowed_line { "         LA    14,SQLPVARS+16              \n" });
             for (size_t i = 0; i < in_params; ++i)
             {
                 if (i > 0)
-                    m_result.emplace_back(replaced_line { "         LA    14,44(,14)                  \n" });
-                m_result.emplace_back(replaced_line { "         LA    15,0                        \n" });
-                m_result.emplace_back(replaced_line { "         ST    15,4(,14)                   \n" });
-                m_result.emplace_back(replaced_line { "         MVC   0(2,14),=X'0000'            \n" });
-                m_result.emplace_back(replaced_line { "         MVC   2(2,14),=H'0'               \n" });
-                m_result.emplace_back(replaced_line { "         SLR   15,15                       \n" });
-                m_result.emplace_back(replaced_line { "         ST    15,8(,14)                   \n" });
-                m_result.emplace_back(replaced_line { "         SLR   15,15                       \n" });
-                m_result.emplace_back(replaced_line { "         ST    15,12(,14)                  \n" });
+                    m_result.emplace_back(borrowed_line { "         LA    14,44(,14)                  \n" });
+                m_result.emplace_back(borrowed_line { "         LA    15,0                        \n" });
+                m_result.emplace_back(borrowed_line { "         ST    15,4(,14)                   \n" });
+                m_result.emplace_back(borrowed_line { "         MVC   0(2,14),=X'0000'            \n" });
+                m_result.emplace_back(borrowed_line { "         MVC   2(2,14),=H'0'               \n" });
+                m_result.emplace_back(borrowed_line { "         SLR   15,15                       \n" });
+                m_result.emplace_back(borrowed_line { "         ST    15,8(,14)                   \n" });
+                m_result.emplace_back(borrowed_line { "         SLR   15,15                       \n" });
+                m_result.emplace_back(borrowed_line { "         ST    15,12(,14)                  \n" });
             }
-            m_result.emplace_back(replaced_line { "         LA    14,SQLPVARS                   \n" });
-            m_result.emplace_back(replaced_line { "         MVC   0(8,14),=XL8'0000000000000000'\n" });
-            m_result.emplace_back(replaced_line { "         MVC   8(4,14),=F'0'                 \n" });
-            m_result.emplace_back(replaced_line { "         MVC   12(2,14),=H'0'                \n" });
-            m_result.emplace_back(replaced_line { "         MVC   14(2,14),=H'0'                \n" });
-            m_result.emplace_back(replaced_line { "         ST    14,SQLVPARM                   \n" });
+            m_result.emplace_back(borrowed_line { "         LA    14,SQLPVARS                   \n" });
+            m_result.emplace_back(borrowed_line { "         MVC   0(8,14),=XL8'0000000000000000'\n" });
+            m_result.emplace_back(borrowed_line { "         MVC   8(4,14),=F'0'                 \n" });
+            m_result.emplace_back(borrowed_line { "         MVC   12(2,14),=H'0'                \n" });
+            m_result.emplace_back(borrowed_line { "         MVC   14(2,14),=H'0'                \n" });
+            m_result.emplace_back(borrowed_line { "         ST    14,SQLVPARM                   \n" });
         }
-        m_result.emplace_back(replaced_line { "         MVC   SQLAPARM,=XL4'00000000'     \n" });
-
-        m_result.emplace_back(replaced_line { "         LA    1,SQLPLLEN                  \n" });
-        m_result.emplace_back(replaced_line { "         ST    1,SQLPLIST                  \n" });
-        m_result.emplace_back(replaced_line { "         OI    SQLPLIST,X'80'              \n" });
-        m_result.emplace_back(replaced_line { "         LA    1,SQLPLIST                  \n" });
-        m_result.emplace_back(replaced_line { "         L     15,=V(DSNHLI)               \n" });
-        m_result.emplace_back(replaced_line { "         BALR  14,15                       \n" });
+        m_result.emplace_back(borrowed_line { "         MVC   SQLAPARM,=XL4'00000000'     \n" });
+
+        m_result.emplace_back(borrowed_line { "         LA    1,SQLPLLEN                  \n" });
+        m_result.emplace_back(borrowed_line { "         ST    1,SQLPLIST                  \n" });
+        m_result.emplace_back(borrowed_line { "         OI    SQLPLIST,X'80'              \n" });
+        m_result.emplace_back(borrowed_line { "         LA    1,SQLPLIST                  \n" });
+        m_result.emplace_back(borrowed_line { "         L     15,=V(DSNHLI)               \n" });
+        m_result.emplace_back(borrowed_line { "         BALR  14,15                       \n" });
     }
 
     void skip_process(line_iterator& it, line_iterator end)
@@ -1101,7 +1102,7 @@ class db2_preprocessor final : public preprocessor // TODO Take DBCS into accoun
                         args = parser.get_args(it_b, it_e, ll.m_lineno);
                         if (sql_has_codegen(it_b, it_e))
                             generate_sql_code_mock(args.size());
-                        m_result.emplace_back(replaced_line { "***$$$\n" });
+                        m_result.emplace_back(borrowed_line { "***$$$\n" });
                     }
 
                     break;
@@ -93,11 +93,12 @@ class endevor_preprocessor final : public preprocessor
         else
         {
             auto& [lib_text, lib_loc] = *library;
-            document member_doc(lib_text);
-            member_doc.convert_to_replaced();
-            stack.emplace_back(member_upper, std::move(member_doc));
-            append_included_member(std::make_unique<included_member_details>(
-                included_member_details { std::move(member_upper), std::move(lib_text), std::move(lib_loc) }));
+            auto details = std::make_unique<included_member_details>(
+                included_member_details { std::move(member_upper), std::move(lib_text), std::move(lib_loc) });
+            document member_doc(details->text);
+            member_doc.convert_to_borrowed();
+            stack.emplace_back(details->name, std::move(member_doc));
+            append_included_member(std::move(details));
         }
 
         co_return true;
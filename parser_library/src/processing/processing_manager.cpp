@@ -43,17 +43,22 @@ processing_manager::processing_manager(std::unique_ptr<opencode_provider> base_p
     statement_fields_parser& parser,
     std::shared_ptr<std::vector<fade_message>> fade_msgs,
     output_handler* output,
-    diagnosable_ctx& diag_ctx)
+    diagnosable_ctx& diag_ctx,
+    bool collect_occurrences)
     : ctx_(ctx)
     , hlasm_ctx_(*ctx_.hlasm_ctx)
     , lib_provider_(lib_provider)
     , opencode_prov_(*base_provider)
     , diag_ctx(diag_ctx)
     , lsp_analyzer_(*ctx_.hlasm_ctx, *ctx_.lsp_ctx, file_text)
-    , stms_analyzers_({ &lsp_analyzer_ })
     , file_loc_(file_loc)
     , m_fade_msgs(std::move(fade_msgs))
+    , m_collect_occurrences(collect_occurrences)
 {
+    // macro and copy member definitions needed for fading are recorded regardless of the occurrences
+    if (m_collect_occurrences)
+        stms_analyzers_.push_back(&lsp_analyzer_);
+
     switch (proc_kind)
     {
         case processing_kind::ORDINARY:
@@ -79,6 +84,32 @@ processing_manager::processing_manager(std::unique_ptr<opencode_provider> base_p
     opencode_prov_.onetime_action();
 }
 
+context::hlasm_context::opcode_lookup_phase lookup_phase(processing_kind proc_kind, statement_provider_kind prov_kind)
+{
+    using enum context::hlasm_context::opcode_lookup_phase;
+    switch (proc_kind)
+    {
+        case processing_kind::ORDINARY:
+            switch (prov_kind)
+            {
+                case statement_provider_kind::COPY:
+                    return copy;
+                case statement_provider_kind::OPEN:
+                    return open_code;
+                case statement_provider_kind::MACRO:
+                    return macro;
+            }
+            break;
+        case processing_kind::LOOKAHEAD:
+            return lookahead;
+        case processing_kind::COPY:
+            return copy;
+        case processing_kind::MACRO:
+            return macro;
+    }
+    return open_code;
+}
+
 void update_metrics(processing_kind proc_kind, statement_provider_kind prov_kind, performance_metrics& metrics)
 {
     switch (proc_kind)
@@ -125,6 +156,8 @@ utils::task processing_manager::co_step()
             continue;
         }
 
+        // opcodes are looked up while the statement is parsed and processed
+        hlasm_ctx_.opcode_phase = lookup_phase(proc.kind, prov.kind);
         if (auto stmt = prov.get_next(proc))
         {
             update_metrics(proc.kind, prov.kind, hlasm_ctx_.metrics);
@@ -218,7 +251,8 @@ void processing_manager::finish_preprocessor()
             m_fade_msgs->emplace_back(fade_message::preprocessor_statement(
                 file_loc_.get_uri(), *stmt->m_details.instruction.preproc_specific_r));
 
-        lsp_analyzer_.analyze(*stmt);
+        if (m_collect_occurrences)
+            lsp_analyzer_.analyze(*stmt);
     }
 
     for (const auto& inc_member_details : preproc->view_included_members())
@@ -256,11 +290,16 @@ void processing_manager::finish_macro_definition(macrodef_processing_result resu
     lsp_analyzer_.macrodef_finished(std::move(mac), std::move(result));
 }
 
+bool processing_manager::lookahead_stop_ahead() const
+{
+    return hlasm_ctx_.current_source().end_index < lookahead_stop_.begin_index
+        && (!hlasm_ctx_.in_opencode() || hlasm_ctx_.current_ainsert_id() <= lookahead_stop_ainsert_id);
+}
+
 void processing_manager::start_lookahead(lookahead_start_data start)
 {
     // jump to the statement where the previous lookahead stopped
-    if (hlasm_ctx_.current_source().end_index < lookahead_stop_.begin_index
-        && (!hlasm_ctx_.in_opencode() || hlasm_ctx_.current_ainsert_id() <= lookahead_stop_ainsert_id))
+    if (lookahead_stop_ahead())
         perform_opencode_jump(context::source_position(lookahead_stop_.end_index), lookahead_stop_);
 
     hlasm_ctx_.push_statement_processing(processing_kind::LOOKAHEAD);
@@ -272,6 +311,7 @@ void processing_manager::finish_lookahead(lookahead_processing_result result)
 {
     lookahead_stop_ = hlasm_ctx_.current_source().create_snapshot();
     lookahead_stop_ainsert_id = hlasm_ctx_.current_ainsert_id();
+    lookahead_exhausted_ = !result.success;
 
     if (result.action == lookahead_action::SEQ)
     {
@@ -294,6 +334,21 @@ void processing_manager::finish_lookahead(lookahead_processing_result result)
     }
 }
 
+bool processing_manager::resolve_attribute_lookahead(std::span<const context::id_index> targets)
+{
+    // every label between the current statement and the end of the source has already been registered,
+    // so a new lookahead would only mark the targets as unknown
+    if (!lookahead_exhausted_ || !lookahead_stop_ahead())
+        return false;
+
+    library_info_transitional li(lib_provider_);
+    for (const auto& target : targets)
+        hlasm_ctx_.ord_ctx.add_symbol_reference(
+            target, context::symbol_attributes(context::symbol_origin::UNKNOWN), li);
+
+    return true;
+}
+
 void processing_manager::start_copy_member(copy_start_data start)
 {
     hlasm_ctx_.push_statement_processing(processing_kind::COPY, std::move(start.member_loc));
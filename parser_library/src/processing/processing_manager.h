@@ -57,7 +57,8 @@ public:
         statement_fields_parser& parser,
         std::shared_ptr<std::vector<fade_message>> fade_msgs,
         output_handler* output,
-        diagnosable_ctx& diag_ctx);
+        diagnosable_ctx& diag_ctx,
+        bool collect_occurrences = true);
 
     [[nodiscard]] utils::task co_step();
 
@@ -95,14 +96,18 @@ private:
 
     context::source_snapshot lookahead_stop_;
     size_t lookahead_stop_ainsert_id = 0;
+    // the last lookahead scanned the rest of the source
+    bool lookahead_exhausted_ = false;
 
     std::shared_ptr<std::vector<fade_message>> m_fade_msgs;
+    bool m_collect_occurrences;
 
     std::map<std::pair<context::id_index, processing::processing_kind>, bool> m_external_requests;
 
     bool attr_lookahead_active() const;
     bool seq_lookahead_active() const;
     bool lookahead_active() const;
+    bool lookahead_stop_ahead() const;
 
     statement_provider& find_provider() const;
     void finish_processor();
@@ -112,6 +117,7 @@ private:
     void finish_macro_definition(macrodef_processing_result result) override;
     void start_lookahead(lookahead_start_data start) override;
     void finish_lookahead(lookahead_processing_result result) override;
+    bool resolve_attribute_lookahead(std::span<const context::id_index> targets) override;
     void start_copy_member(copy_start_data start) override;
     void finish_copy_member(copy_processing_result result) override;
     void finish_opencode() override;
@@ -15,6 +15,8 @@
 #ifndef PROCESSING_PROCESSING_STATE_LISTENER_H
 #define PROCESSING_PROCESSING_STATE_LISTENER_H
 
+#include <span>
+
 #include "statement_processors/copy_processing_info.h"
 #include "statement_processors/lookahead_processing_info.h"
 #include "statement_processors/macrodef_processing_info.h"
@@ -44,6 +46,8 @@ public:
 
     virtual void start_lookahead(lookahead_start_data start) = 0;
     virtual void finish_lookahead(lookahead_processing_result result) = 0;
+    // resolves attribute lookahead targets without scanning the source when possible
+    virtual bool resolve_attribute_lookahead(std::span<const context::id_index> targets) = 0;
 
     virtual void start_copy_member(copy_start_data start) = 0;
     virtual void finish_copy_member(copy_processing_result result) = 0;
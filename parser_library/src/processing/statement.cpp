@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include "statement.h"
+
+namespace hlasm_plugin::parser_library::processing {
+
+namespace {
+bool same_op_code(const op_code& l, const op_code& r) noexcept
+{
+    if (l.value != r.value || l.type != r.type)
+        return false;
+
+    switch (l.type)
+    {
+        case context::instruction_type::MAC:
+            return l.mac_def == r.mac_def;
+        case context::instruction_type::ASM:
+            return l.instr_asm == r.instr_asm;
+        case context::instruction_type::MACH:
+            return l.instr_mach == r.instr_mach;
+        case context::instruction_type::MNEMO:
+            return l.instr_mnemo == r.instr_mnemo;
+        default:
+            return true;
+    }
+}
+} // namespace
+
+const reparsed_operands_cache::entry* reparsed_operands_cache::find(
+    std::string_view text, const substitution_map& map, const processing_status& status) const noexcept
+{
+    for (const auto& e : m_entries)
+    {
+        if (e.text == text && e.format == status.first && same_op_code(e.opcode, status.second) && e.map == map)
+            return &e;
+    }
+    return nullptr;
+}
+
+const reparsed_operands_cache::entry& reparsed_operands_cache::insert(entry e)
+{
+    if (m_entries.size() < max_entries)
+        return m_entries.emplace_back(std::move(e));
+
+    auto& result = m_entries[m_next];
+    m_next = (m_next + 1) % max_entries;
+
+    return result = std::move(e);
+}
+
+} // namespace hlasm_plugin::parser_library::processing
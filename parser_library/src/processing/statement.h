@@ -16,15 +16,53 @@
 #define PROCESSING_STATEMENT_H
 
 #include <optional>
+#include <string>
 #include <variant>
 
+#include "diagnostic_op.h"
 #include "op_code.h"
+#include "semantics/range_provider.h"
 #include "semantics/statement.h"
 
 // this file contains inherited structures from hlasm_statement that are used during the processing
 
 namespace hlasm_plugin::parser_library::processing {
 
+// operands of a model statement reparsed after substitution
+struct reparsed_operands
+{
+    semantics::operands_si operands;
+    std::vector<semantics::literal_si> literals;
+};
+
+// remembers reparsed operands of a model statement that is shared by many macro or copy member invocations
+// avoids reparsing when the same text is produced by the substitution again
+class reparsed_operands_cache
+{
+public:
+    using substitution_map = std::vector<std::pair<std::pair<size_t, bool>, range>>;
+
+    struct entry
+    {
+        std::string text;
+        substitution_map map;
+        op_code opcode;
+        processing_format format;
+        std::shared_ptr<const reparsed_operands> result;
+        std::vector<diagnostic_op> diags;
+    };
+
+    const entry* find(
+        std::string_view text, const substitution_map& map, const processing_status& status) const noexcept;
+    const entry& insert(entry e);
+
+private:
+    static constexpr size_t max_entries = 4;
+
+    std::vector<entry> m_entries;
+    size_t m_next = 0;
+};
+
 // statement that contains resolved operation code and also all semantic fields
 struct resolved_statement : public context::hlasm_statement
 {
@@ -37,6 +75,11 @@ struct resolved_statement : public context::hlasm_statement
     virtual const op_code& opcode_ref() const = 0;
     virtual processing_format format_ref() const = 0;
 
+    // Cache for model operands, available when the statement is reused by subsequent invocations.
+    // The statement stays logically const: the cache only memoizes the parse of the substituted operand text,
+    // keyed by the text, its range map and the processing status, so a hit is indistinguishable from a reparse.
+    virtual reparsed_operands_cache* reparse_cache() const { return nullptr; }
+
     resolved_statement()
         : context::hlasm_statement(context::statement_kind::RESOLVED)
     {}
@@ -50,18 +93,15 @@ struct rebuilt_statement final : public resolved_statement
 {
     rebuilt_statement(std::shared_ptr<const resolved_statement> base_stmt,
         std::optional<semantics::label_si> label,
-        std::optional<semantics::operands_si> operands,
-        std::optional<std::vector<semantics::literal_si>> literals)
+        std::shared_ptr<const reparsed_operands> operands)
         : base_stmt(std::move(base_stmt))
         , rebuilt_label(std::move(label))
         , rebuilt_operands(std::move(operands))
-        , rebuilt_literals(std::move(literals))
     {}
 
     std::shared_ptr<const resolved_statement> base_stmt;
     std::optional<semantics::label_si> rebuilt_label;
-    std::optional<semantics::operands_si> rebuilt_operands;
-    std::optional<std::vector<semantics::literal_si>> rebuilt_literals;
+    std::shared_ptr<const reparsed_operands> rebuilt_operands;
 
     const range& stmt_range_ref() const override { return base_stmt->stmt_range_ref(); }
 
@@ -72,11 +112,11 @@ struct rebuilt_statement final : public resolved_statement
     const semantics::instruction_si& instruction_ref() const override { return base_stmt->instruction_ref(); }
     const semantics::operands_si& operands_ref() const override
     {
-        return rebuilt_operands ? *rebuilt_operands : base_stmt->operands_ref();
+        return rebuilt_operands ? rebuilt_operands->operands : base_stmt->operands_ref();
     }
     std::span<const semantics::literal_si> literals() const override
     {
-        return rebuilt_literals ? *rebuilt_literals : base_stmt->literals();
+        return rebuilt_operands ? rebuilt_operands->literals : base_stmt->literals();
     }
     const semantics::remarks_si& remarks_ref() const override { return base_stmt->remarks_ref(); }
     const op_code& opcode_ref() const override { return base_stmt->opcode_ref(); }
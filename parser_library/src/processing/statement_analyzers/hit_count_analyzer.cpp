@@ -14,6 +14,7 @@
 
 #include "hit_count_analyzer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <optional>
 #include <tuple>
@@ -26,6 +27,72 @@
 
 namespace hlasm_plugin::parser_library::processing {
 
+namespace {
+void append_run(std::vector<line_run>& runs, size_t end, const line_detail& detail)
+{
+    if (!runs.empty() && runs.back().detail == detail)
+        runs.back().end = end;
+    else
+        runs.push_back({ end, detail });
+}
+} // namespace
+
+hit_count_entry::hit_count_entry(std::span<const line_detail> lines)
+{
+    for (size_t i = 0; i < lines.size(); ++i)
+        append_run(m_runs, i + 1, lines[i]);
+}
+
+hit_count_entry& hit_count_entry::merge(const hit_count_entry& other)
+{
+    has_sections |= other.has_sections;
+
+    if (other.m_runs.empty())
+        return *this;
+    if (m_runs.empty())
+    {
+        m_runs = other.m_runs;
+        return *this;
+    }
+
+    std::vector<line_run> result;
+    result.reserve(m_runs.size() + other.m_runs.size());
+
+    auto l = m_runs.begin();
+    auto r = other.m_runs.begin();
+    while (l != m_runs.end() && r != other.m_runs.end())
+    {
+        const auto end = std::min(l->end, r->end);
+        append_run(result, end, l->detail.merge(r->detail));
+        l += l->end == end;
+        r += r->end == end;
+    }
+    for (; l != m_runs.end(); ++l)
+        append_run(result, l->end, l->detail);
+    for (; r != other.m_runs.end(); ++r)
+        append_run(result, r->end, r->detail);
+
+    m_runs = std::move(result);
+
+    return *this;
+}
+
+bool hit_count_entry::contains_prototype(size_t line) const noexcept
+{
+    const auto it = std::ranges::upper_bound(m_runs, line, {}, &line_run::end);
+    return it != m_runs.end() && it->detail.macro_prototype;
+}
+
+std::vector<line_detail> hit_count_entry::lines() const
+{
+    std::vector<line_detail> result;
+    result.reserve(line_count());
+    for (const auto& run : m_runs)
+        result.resize(run.end, run.detail);
+
+    return result;
+}
+
 hit_count_analyzer::hit_count_analyzer(context::hlasm_context& ctx)
     : m_ctx(ctx)
 {}
@@ -70,7 +137,7 @@ const utils::resource::resource_location& hit_count_analyzer::get_current_stmt_r
     return m_ctx.current_statement_source(proc_kind != processing_kind::LOOKAHEAD);
 }
 
-hit_count_entry& hit_count_analyzer::get_hc_entry_reference(const utils::resource::resource_location& rl)
+hit_count_lines& hit_count_analyzer::get_hc_entry_reference(const utils::resource::resource_location& rl)
 {
     return m_hit_count_map.try_emplace(rl).first->second;
 }
@@ -166,10 +233,15 @@ void hit_count_analyzer::analyze_aread_line(
 hit_count_map hit_count_analyzer::take_hit_count_map()
 {
     auto has_sections = !m_ctx.ord_ctx.sections().empty();
-    for (auto& [_, hc_entry] : m_hit_count_map)
-        hc_entry.has_sections = has_sections;
 
-    return std::move(m_hit_count_map);
+    hit_count_map result;
+    result.reserve(m_hit_count_map.size());
+    for (auto& [rl, hc_lines] : m_hit_count_map)
+        result.try_emplace(rl, hc_lines.details).first->second.has_sections = has_sections;
+
+    m_hit_count_map.clear();
+
+    return result;
 }
 
 } // namespace hlasm_plugin::parser_library::processing
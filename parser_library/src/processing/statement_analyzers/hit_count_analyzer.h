@@ -15,7 +15,7 @@
 #ifndef PROCESSING_HIT_COUNT_ANALYZER_H
 #define PROCESSING_HIT_COUNT_ANALYZER_H
 
-#include <algorithm>
+#include <span>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
@@ -63,24 +63,23 @@ struct line_detail
         macro_body |= is_macro;
         return *this;
     }
+
+    bool operator==(const line_detail&) const = default;
 };
 
-struct hit_count_entry
+// Consecutive lines with identical details, ending just before the line end
+struct line_run
 {
-    std::vector<line_detail> details;
-    bool has_sections = false;
-
-    hit_count_entry& merge(const hit_count_entry& other)
-    {
-        has_sections |= other.has_sections;
-
-        const auto [e, o, _] = std::ranges::transform(details, other.details, details.begin(), &line_detail::merge);
-        details.insert(e, o, other.details.end());
+    size_t end = 0;
+    line_detail detail;
 
-        return *this;
-    }
+    bool operator==(const line_run&) const = default;
+};
 
-    bool contains_prototype(size_t i) const noexcept { return i < details.size() && details[i].macro_prototype; }
+// Dense per-line details collected during the analysis
+struct hit_count_lines
+{
+    std::vector<line_detail> details;
 
     void emplace_prototype(size_t line)
     {
@@ -88,12 +87,6 @@ struct hit_count_entry
         details[line].macro_prototype = true;
     }
 
-    void add(size_t line, size_t count, bool is_macro)
-    {
-        update_max_and_resize(line);
-        details[line].add(count, is_macro);
-    }
-
     void add(const stmt_lines_range& lines_range, size_t count, bool is_macro)
     {
         const auto& [start_line, end_line] = lines_range;
@@ -111,6 +104,27 @@ private:
     }
 };
 
+// Run-length encoded line details retained after the analysis
+struct hit_count_entry
+{
+    bool has_sections = false;
+
+    hit_count_entry() = default;
+    explicit hit_count_entry(std::span<const line_detail> lines);
+
+    hit_count_entry& merge(const hit_count_entry& other);
+
+    bool contains_prototype(size_t line) const noexcept;
+
+    const std::vector<line_run>& runs() const noexcept { return m_runs; }
+    size_t line_count() const noexcept { return m_runs.empty() ? 0 : m_runs.back().end; }
+
+    std::vector<line_detail> lines() const;
+
+private:
+    std::vector<line_run> m_runs;
+};
+
 using hit_count_map = std::unordered_map<utils::resource::resource_location, hit_count_entry>;
 
 class hit_count_analyzer final : public statement_analyzer
@@ -139,12 +153,12 @@ private:
     };
 
     context::hlasm_context& m_ctx;
-    hit_count_map m_hit_count_map;
+    std::unordered_map<utils::resource::resource_location, hit_count_lines> m_hit_count_map;
     statement_type m_next_stmt_type = statement_type::REGULAR;
     size_t m_macro_level = 0;
 
     const utils::resource::resource_location& get_current_stmt_rl(processing_kind proc_kind) const;
-    hit_count_entry& get_hc_entry_reference(const utils::resource::resource_location& rl);
+    hit_count_lines& get_hc_entry_reference(const utils::resource::resource_location& rl);
 
     statement_type get_stmt_type(const semantics::instruction_si& instr, const op_code* op);
 };
@@ -97,6 +97,9 @@ void lookahead_processor::end_processing()
 {
     hlasm_ctx.pop_statement_processing();
 
+    if (action == lookahead_action::ORD)
+        result_.success = to_find_.empty();
+
     for (auto&& symbol_name : to_find_)
         register_attr_ref(symbol_name, context::symbol_attributes(context::symbol_origin::UNKNOWN));
 
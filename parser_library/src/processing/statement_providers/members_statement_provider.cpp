@@ -129,6 +129,9 @@ struct statement_si_defer_done final
     semantics::operands_si operands;
     semantics::remarks_si remarks;
     std::vector<semantics::literal_si> collected_literals;
+
+    // shared by all the adapters of the statement, see resolved_statement::reparse_cache
+    reparsed_operands_cache model_cache;
 };
 
 const context::statement_cache::cached_statement_t& members_statement_provider::fill_cache(
@@ -172,12 +175,12 @@ const context::statement_cache::cached_statement_t& members_statement_provider::
 
 struct deferred_statement_adapter final : public resolved_statement
 {
-    deferred_statement_adapter(std::shared_ptr<const statement_si_defer_done> base_stmt, processing_status status)
+    deferred_statement_adapter(std::shared_ptr<statement_si_defer_done> base_stmt, processing_status status)
         : base_stmt(std::move(base_stmt))
         , status(std::move(status))
     {}
 
-    std::shared_ptr<const statement_si_defer_done> base_stmt;
+    std::shared_ptr<statement_si_defer_done> base_stmt;
     processing_status status;
 
     const range& stmt_range_ref() const override { return base_stmt->deferred_stmt->stmt_range; }
@@ -189,6 +192,7 @@ struct deferred_statement_adapter final : public resolved_statement
     const op_code& opcode_ref() const override { return status.second; }
     processing_format format_ref() const override { return status.first; }
     std::span<const diagnostic_op> diagnostics() const override { return {}; }
+    reparsed_operands_cache* reparse_cache() const override { return &base_stmt->model_cache; }
 };
 
 
@@ -211,7 +215,7 @@ context::shared_stmt_ptr members_statement_provider::preprocess_deferred(const s
             m_diagnoser.add_diagnostic(diag);
     }
 
-    return std::make_shared<deferred_statement_adapter>(cache_item->stmt, status);
+    return m_adapter_pool.make_shared<deferred_statement_adapter>(cache_item->stmt, std::move(status));
 }
 
 } // namespace hlasm_plugin::parser_library::processing
@@ -20,6 +20,7 @@
 #include "processing/processing_state_listener.h"
 #include "processing/statement_fields_parser.h"
 #include "statement_provider.h"
+#include "utils/pooled_allocator.h"
 
 namespace hlasm_plugin::parser_library {
 class parse_lib_provider;
@@ -59,6 +60,8 @@ protected:
     processing::processing_state_listener& m_listener;
     diagnostic_op_consumer& m_diagnoser;
     std::optional<std::optional<context::id_index>> m_resolved_instruction;
+    // statements produced by preprocess_deferred are usually discarded right after being processed
+    utils::object_pool m_adapter_pool;
 
     virtual std::pair<context::statement_cache*, std::optional<std::optional<context::id_index>>> get_next() = 0;
     virtual std::vector<diagnostic_op> filter_cached_diagnostics(
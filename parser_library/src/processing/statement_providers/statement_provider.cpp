@@ -35,9 +35,7 @@ bool statement_provider::try_trigger_attribute_lookahead(const semantics::instru
     if (references_buffer.empty())
         return false;
 
-    trigger_attribute_lookahead(std::move(references_buffer), eval_ctx, listener);
-
-    return true;
+    return trigger_attribute_lookahead(std::move(references_buffer), eval_ctx, listener);
 }
 
 bool statement_provider::try_trigger_attribute_lookahead(const context::hlasm_statement& statement,
@@ -66,15 +64,19 @@ bool statement_provider::try_trigger_attribute_lookahead(const context::hlasm_st
     if (references_buffer.empty())
         return false;
 
-    trigger_attribute_lookahead(std::move(references_buffer), eval_ctx, listener);
-
-    return true;
+    return trigger_attribute_lookahead(std::move(references_buffer), eval_ctx, listener);
 }
 
-void statement_provider::trigger_attribute_lookahead(std::vector<context::id_index>&& references_buffer,
+bool statement_provider::trigger_attribute_lookahead(std::vector<context::id_index>&& references_buffer,
     const expressions::evaluation_context& eval_ctx,
     processing::processing_state_listener& listener)
 {
+    std::ranges::sort(references_buffer);
+    references_buffer.erase(std::ranges::unique(references_buffer).begin(), references_buffer.end());
+
+    if (listener.resolve_attribute_lookahead(references_buffer))
+        return false;
+
     auto snapshot = eval_ctx.hlasm_ctx.current_source().create_snapshot();
     const bool has_copybooks = !snapshot.copy_frames.empty();
     const auto in_macro = eval_ctx.hlasm_ctx.is_in_macro();
@@ -82,12 +84,10 @@ void statement_provider::trigger_attribute_lookahead(std::vector<context::id_ind
     if (has_copybooks && !in_macro)
         snapshot.copy_frames.back().adjust_to_beginning();
 
-    std::ranges::sort(references_buffer);
-
     listener.start_lookahead(
-        lookahead_start_data(std::vector(references_buffer.begin(), std::ranges::unique(references_buffer).begin()),
-            context::source_position(opencode_line),
-            std::move(snapshot)));
+        lookahead_start_data(references_buffer, context::source_position(opencode_line), std::move(snapshot)));
+
+    return true;
 }
 
 bool statement_provider::process_label(std::vector<context::id_index>& symbols,
@@ -73,7 +73,7 @@ context::SET_t variable_symbol::evaluate(const expressions::evaluation_context&
 {
     auto [name, evaluated_subscript] = evaluate_symbol(eval_ctx);
 
-    auto val = get_var_sym_value(eval_ctx, name, evaluated_subscript, symbol_range);
+    auto val = get_var_sym_value(eval_ctx, name, evaluated_subscript, symbol_range, named() ? &slot_hint : nullptr);
 
     return val;
 }
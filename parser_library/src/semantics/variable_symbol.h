@@ -21,6 +21,7 @@
 #include <vector>
 
 #include "context/id_index.h"
+#include "context/variable_slots.h"
 #include "expressions/conditional_assembly/ca_expression.h"
 #include "range.h"
 
@@ -37,6 +38,8 @@ struct variable_symbol
     std::variant<context::id_index, concat_chain> value;
     std::vector<expressions::ca_expr_ptr> subscript;
     range symbol_range;
+    // slot of the named variable in the scope the symbol was last evaluated in
+    mutable context::variable_slot_hint slot_hint;
 
     const auto* named() const noexcept { return std::get_if<context::id_index>(&value); }
     const auto* created() const noexcept { return std::get_if<concat_chain>(&value); }
@@ -41,6 +41,7 @@
 #include "external_configuration_requests.h"
 #include "fade_messages.h"
 #include "folding_range.h"
+#include "memory_stats.h"
 #include "nlohmann/json.hpp"
 #include "protocol.h"
 #include "utils/async_busy_wait.h"
@@ -199,6 +200,9 @@ class workspace_manager_impl final : public workspace_manager,
 
         bool workspace_removed = false;
 
+        // document of a query that needs the full analysis
+        std::optional<utils::resource::resource_location> full_analysis_document = std::nullopt;
+
         bool is_valid() const { return !validator || validator(); }
         bool remove_pending_request(unsigned long long rid)
         {
@@ -416,6 +420,11 @@ class workspace_manager_impl final : public workspace_manager,
             else if (parsing_done)
                 return;
 
+            // changes received after the query may have scheduled only a background reparse
+            if (!m_work_queue.empty())
+                if (const auto& document = m_work_queue.front().full_analysis_document)
+                    m_ws.request_full_analysis(*document);
+
             if (m_active_task.valid())
             {
                 if (!run_active_task(yield_indicator))
@@ -542,7 +551,8 @@ class workspace_manager_impl final : public workspace_manager,
     utils::value_task<std::optional<std::vector<index_t<workspaces::processor_group, unsigned long long>>>>
     handle_library_refresh(
         std::shared_ptr<std::pair<std::vector<resource_location>, std::vector<workspaces::file_content_state>>>
-            paths_for_ws)
+            paths_for_ws,
+        std::vector<fs_change_type> change_types)
     {
         std::optional<std::vector<index_t<workspaces::processor_group, unsigned long long>>> proc_grps;
         const auto updater = [&proc_grps](auto r) {
@@ -558,9 +568,9 @@ class workspace_manager_impl final : public workspace_manager,
         const auto& [paths, changes] = *paths_for_ws;
         std::vector<utils::task> tasks;
         tasks.reserve(1 + m_workspaces.size());
-        tasks.emplace_back(m_implicit_workspace.config.refresh_libraries(paths).then(updater));
+        tasks.emplace_back(m_implicit_workspace.config.refresh_libraries(paths, change_types).then(updater));
         for (auto& [_, ows] : m_workspaces)
-            tasks.emplace_back(ows.config.refresh_libraries(paths).then(updater));
+            tasks.emplace_back(ows.config.refresh_libraries(paths, change_types).then(updater));
 
         co_await utils::task::wait_all(std::move(tasks));
 
@@ -571,8 +581,13 @@ class workspace_manager_impl final : public workspace_manager,
     {
         auto paths_for_ws =
             std::make_shared<std::pair<std::vector<resource_location>, std::vector<workspaces::file_content_state>>>();
+        std::vector<fs_change_type> change_types;
+        change_types.reserve(fs_changes.size());
         for (const auto& change : fs_changes)
+        {
             paths_for_ws->first.emplace_back(normalized_uri(change.uri));
+            change_types.emplace_back(change.change_type);
+        }
 
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
@@ -602,8 +617,8 @@ class workspace_manager_impl final : public workspace_manager,
 
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
-            std::function<utils::task()>([this, paths = std::move(paths_for_ws)]() {
-                return handle_library_refresh(paths).then([this, paths](auto r) {
+            std::function<utils::task()>([this, paths = std::move(paths_for_ws), types = std::move(change_types)]() {
+                return handle_library_refresh(paths, types).then([this, paths](auto r) {
                     auto& [f, c] = *paths;
                     return m_ws.did_change_watched_files(std::move(f), std::move(c), std::move(r));
                 });
@@ -658,12 +673,21 @@ class workspace_manager_impl final : public workspace_manager,
     }
 
     template<typename R, request_handler<R> A>
-    void handle_request(std::string_view document_uri, workspace_manager_response<R> r, A a)
+    void handle_request(std::string_view document_uri, workspace_manager_response<R> r, A a, bool full_analysis = true)
     {
-        m_work_queue.emplace_back(work_item {
+        auto doc_loc = normalized_uri(document_uri);
+        // background reparses skip semantic tokens and symbol occurrences, queries using them need the full analysis
+        std::optional<utils::resource::resource_location> full_analysis_document;
+        if (full_analysis)
+        {
+            m_ws.request_full_analysis(doc_loc);
+            full_analysis_document = doc_loc;
+        }
+
+        auto& item = m_work_queue.emplace_back(work_item {
             next_unique_id(),
             response_handle(r,
-                [this, doc_loc = normalized_uri(document_uri), a = std::move(a)](
+                [this, doc_loc = std::move(doc_loc), a = std::move(a)](
                     const workspace_manager_response<R>& resp) {
                     if constexpr (requires { std::invoke(a, resp, m_ws, doc_loc); })
                         std::invoke(a, resp, m_ws, doc_loc);
@@ -673,6 +697,7 @@ class workspace_manager_impl final : public workspace_manager,
             [r]() { return r.valid(); },
             work_item_type::query,
         });
+        item.full_analysis_document = std::move(full_analysis_document);
     }
 
     void definition(std::string_view document_uri, position pos, workspace_manager_response<const location&> r) override
@@ -739,6 +764,8 @@ class workspace_manager_impl final : public workspace_manager,
         // TODO: should this action be also performed IN ORDER?
 
         m_global_config = new_config;
+        const auto budget_mb = m_global_config.fill_missing_settings(lib_config()).memory_budget.value();
+        m_ws.set_memory_budget(static_cast<std::size_t>(std::max<int64_t>(budget_mb, 0)) << 20);
 
         auto cfg = std::make_shared<const nlohmann::json>(
             full_cfg.empty() ? nlohmann::json() : nlohmann::json::parse(full_cfg));
@@ -783,9 +810,11 @@ class workspace_manager_impl final : public workspace_manager,
 
     void folding(std::string_view document_uri, workspace_manager_response<std::span<const folding_range>> r) override
     {
-        handle_request(document_uri, std::move(r), [](const auto& resp, auto& ws, const auto& doc_loc) {
-            resp.provide(ws.folding(doc_loc));
-        });
+        handle_request(
+            document_uri,
+            std::move(r),
+            [](const auto& resp, auto& ws, const auto& doc_loc) { resp.provide(ws.folding(doc_loc)); },
+            false);
     }
 
     std::string get_virtual_file_content(unsigned long long id) const override
@@ -878,17 +907,18 @@ class workspace_manager_impl final : public workspace_manager,
 
     unsigned long long next_unique_id() { return ++m_unique_id_sequence; }
 
+    struct external_text_t
+    {
+        std::optional<std::string> result;
+
+        void provide(std::string_view c) { result = std::string(c); }
+        void error(int, const char*) noexcept { result.reset(); }
+    };
+
     [[nodiscard]] utils::value_task<std::optional<std::string>> load_text_external(
         const utils::resource::resource_location& document_loc) const
     {
-        struct content_t
-        {
-            std::optional<std::string> result;
-
-            void provide(std::string_view c) { result = std::string(c); }
-            void error(int, const char*) noexcept { result.reset(); }
-        };
-        auto [channel, data] = make_workspace_manager_response(std::in_place_type<content_t>);
+        auto [channel, data] = make_workspace_manager_response(std::in_place_type<external_text_t>);
         m_args.external_requests->read_external_file(document_loc.get_uri(), channel);
 
         return utils::async_busy_wait(std::move(channel), &data->result);
@@ -906,6 +936,48 @@ class workspace_manager_impl final : public workspace_manager,
         return load_text_external(document_loc);
     }
 
+    [[nodiscard]] utils::value_task<std::vector<std::optional<std::string>>> load_texts(
+        std::vector<utils::resource::resource_location> document_locs) const override
+    {
+        struct pending_t
+        {
+            size_t index;
+            workspace_manager_response<std::string_view> channel;
+            external_text_t* data;
+        };
+
+        std::vector<std::optional<std::string>> result(document_locs.size());
+        std::vector<pending_t> pending;
+
+        for (size_t i = 0; i < document_locs.size(); ++i)
+        {
+            const auto& loc = document_locs[i];
+            if (loc.is_local() && !utils::platform::is_web())
+                result[i] = utils::resource::load_text(loc);
+            else if (m_args.external_requests && m_args.vscode_extensions && allowed_scheme(loc))
+            {
+                auto [channel, data] = make_workspace_manager_response(std::in_place_type<external_text_t>);
+                pending.push_back({ i, std::move(channel), data });
+            }
+        }
+
+        if (!pending.empty())
+        {
+            std::vector<workspace_manager_external_file_request> requests;
+            requests.reserve(pending.size());
+            for (const auto& p : pending)
+                requests.push_back({ document_locs[p.index].get_uri(), p.channel });
+
+            m_args.external_requests->read_external_files(requests);
+        }
+
+        // all the requests are in flight, waiting for them one by one costs a single round-trip
+        for (auto& p : pending)
+            result[p.index] = co_await utils::async_busy_wait(std::move(p.channel), &p.data->result);
+
+        co_return result;
+    }
+
     [[nodiscard]] utils::value_task<std::pair<std::vector<std::pair<std::string, utils::resource::resource_location>>,
         utils::path::list_directory_rc>>
     list_directory_files_external(const utils::resource::resource_location& directory, bool subdir) const
@@ -1163,9 +1235,32 @@ class workspace_manager_impl final : public workspace_manager,
     void retrieve_output(
         std::string_view document_uri, workspace_manager_response<std::span<const output_line>> r) override
     {
-        handle_request(document_uri, std::move(r), [](const auto& resp, auto& ws, const auto& doc_loc) {
-            resp.provide(ws.retrieve_output(doc_loc));
-        });
+        handle_request(
+            document_uri,
+            std::move(r),
+            [](const auto& resp, auto& ws, const auto& doc_loc) { resp.provide(ws.retrieve_output(doc_loc)); },
+            false);
+    }
+
+    void memory_stats(workspace_manager_response<const parser_library::memory_stats&> r) override
+    {
+        parser_library::memory_stats stats;
+
+        m_ws.collect_memory_stats(stats);
+        stats.file_texts = m_file_manager.memory_usage();
+
+        stats.workspaces.push_back({ .library_indexes = m_implicit_workspace.config.libraries_memory_usage() });
+        for (const auto& [uri, ows] : m_workspaces)
+        {
+            if (ows.logically_deleted)
+                continue;
+            stats.workspaces.push_back({
+                .uri = std::string(uri.get_uri()),
+                .library_indexes = ows.config.libraries_memory_usage(),
+            });
+        }
+
+        r.provide(stats);
     }
 
     [[nodiscard]] utils::value_task<
@@ -1203,6 +1298,7 @@ public:
         , m_implicit_workspace(m_file_manager, m_global_config, this, this)
         , m_ws(m_file_manager, *this)
     {
+        m_ws.set_dependency_reporting(args.report_dependencies);
         m_work_queue.emplace_back(work_item {
             next_unique_id(),
             std::function<utils::task()>([this]() -> utils::task {
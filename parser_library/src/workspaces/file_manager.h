@@ -51,6 +51,11 @@ public:
     [[nodiscard]] virtual utils::value_task<std::shared_ptr<file>> add_file(
         const utils::resource::resource_location&) = 0;
 
+    // Adds files with specified file names at once, so that missing contents can be loaded in bulk.
+    // Returns the files in the order of the file names.
+    [[nodiscard]] virtual utils::value_task<std::vector<std::shared_ptr<file>>> add_files(
+        std::vector<utils::resource::resource_location> file_names) = 0;
+
     // Finds file with specified file name, return nullptr if not found.
     virtual std::shared_ptr<file> find(const utils::resource::resource_location& key) const = 0;
 
@@ -64,6 +69,9 @@ public:
     [[nodiscard]] virtual utils::value_task<list_directory_result> list_directory_subdirs_and_symlinks(
         const utils::resource::resource_location& directory) const = 0;
 
+    // Checks whether the resource is a regular file, returns std::nullopt when its type cannot be determined.
+    virtual std::optional<bool> is_regular_file(const utils::resource::resource_location& res_loc) const = 0;
+
     virtual std::string canonical(const utils::resource::resource_location& res_loc, std::error_code& ec) const = 0;
 
     virtual file_content_state did_open_file(
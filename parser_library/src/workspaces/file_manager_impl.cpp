@@ -22,6 +22,7 @@
 
 #include "file.h"
 #include "utils/content_loader.h"
+#include "utils/path.h"
 #include "utils/path_conversions.h"
 #include "utils/platform.h"
 #include "utils/text_convertor.h"
@@ -168,6 +169,25 @@ class : public external_file_reader
 
 } constexpr default_reader;
 
+utils::value_task<std::vector<std::optional<std::string>>> external_file_reader::load_texts(
+    std::vector<utils::resource::resource_location> document_locs) const
+{
+    std::vector<std::optional<std::string>> result;
+    result.reserve(document_locs.size());
+    for (const auto& loc : document_locs)
+        result.push_back(co_await load_text(loc));
+
+    co_return result;
+}
+
+std::optional<bool> external_file_reader::is_regular_file(const utils::resource::resource_location& res_loc) const
+{
+    if (utils::platform::is_web() || !res_loc.is_local())
+        return std::nullopt;
+
+    return utils::path::is_regular_file(res_loc.get_path());
+}
+
 file_manager_impl::file_manager_impl()
     : file_manager_impl(default_reader, nullptr)
 {}
@@ -222,17 +242,54 @@ utils::value_task<std::shared_ptr<file>> file_manager_impl::add_file(
     return m_file_reader->load_text(file_name).then([this, file_name](auto loaded_text) -> std::shared_ptr<file> {
         std::lock_guard g(files_mutex);
 
-        if (auto result = try_obtaining_file_unsafe(file_name, &loaded_text))
-            return result;
+        return emplace_loaded_file_unsafe(file_name, loaded_text);
+    });
+}
 
-        auto result = loaded_text.has_value()
-            ? make_mapped_file(file_name, *this, loaded_text.value(), m_text_convertor)
-            : make_mapped_file(file_name, *this, mapped_file::file_error());
+utils::value_task<std::vector<std::shared_ptr<file>>> file_manager_impl::add_files(
+    std::vector<utils::resource::resource_location> file_names)
+{
+    std::vector<std::shared_ptr<file>> result(file_names.size());
+    std::vector<utils::resource::resource_location> to_load;
+    {
+        std::lock_guard g(files_mutex);
+
+        for (size_t i = 0; i < file_names.size(); ++i)
+        {
+            if (!(result[i] = try_obtaining_file_unsafe(file_names[i], nullptr)))
+                to_load.push_back(file_names[i]);
+        }
+    }
+    if (to_load.empty())
+        co_return result;
+
+    auto loaded_texts = co_await m_file_reader->load_texts(std::move(to_load));
+
+    std::lock_guard g(files_mutex);
+
+    auto loaded_text = loaded_texts.begin();
+    for (size_t i = 0; i < file_names.size() && loaded_text != loaded_texts.end(); ++i)
+    {
+        if (!result[i])
+            result[i] = emplace_loaded_file_unsafe(file_names[i], *loaded_text++);
+    }
 
-        result->m_it = m_files.try_emplace(file_name, result.get()).first;
+    co_return result;
+}
 
+std::shared_ptr<file_manager_impl::mapped_file> file_manager_impl::emplace_loaded_file_unsafe(
+    const utils::resource::resource_location& file_name, std::optional<std::string>& loaded_text)
+{
+    if (auto result = try_obtaining_file_unsafe(file_name, &loaded_text))
         return result;
-    });
+
+    auto result = loaded_text.has_value()
+        ? make_mapped_file(file_name, *this, std::move(loaded_text).value(), m_text_convertor)
+        : make_mapped_file(file_name, *this, mapped_file::file_error());
+
+    result->m_it = m_files.try_emplace(file_name, result.get()).first;
+
+    return result;
 }
 
 std::shared_ptr<file_manager_impl::mapped_file> file_manager_impl::try_obtaining_file_unsafe(
@@ -314,6 +371,11 @@ utils::value_task<list_directory_result> file_manager_impl::list_directory_subdi
     return m_file_reader->list_directory_subdirs_and_symlinks(directory);
 }
 
+std::optional<bool> file_manager_impl::is_regular_file(const utils::resource::resource_location& res_loc) const
+{
+    return m_file_reader->is_regular_file(res_loc);
+}
+
 std::string file_manager_impl::canonical(const utils::resource::resource_location& res_loc, std::error_code& ec) const
 {
     // TODO: this should probably return resource_location
@@ -464,6 +526,26 @@ std::string file_manager_impl::get_virtual_file(unsigned long long id) const
     return {};
 }
 
+std::size_t file_manager_impl::memory_usage() const
+{
+    std::size_t result = 0;
+    {
+        std::lock_guard guard(files_mutex);
+        for (const auto& [_, entry] : m_files)
+        {
+            const auto& f = *entry.file;
+            result += sizeof(f) + f.m_text.capacity() + f.m_text_converted.capacity()
+                + f.m_lines.capacity() * sizeof(size_t);
+        }
+    }
+    {
+        std::lock_guard guard(virtual_files_mutex);
+        for (const auto& [_, entry] : m_virtual_files)
+            result += sizeof(entry) + entry.text.capacity();
+    }
+    return result;
+}
+
 utils::value_task<file_content_state> file_manager_impl::update_file(
     const utils::resource::resource_location& document_loc)
 {
@@ -40,6 +40,13 @@ public:
         const utils::resource::resource_location& directory) const = 0;
     [[nodiscard]] virtual utils::value_task<list_directory_result> list_directory_subdirs_and_symlinks(
         const utils::resource::resource_location& directory) const = 0;
+    // Only the types of local files are determined by default.
+    virtual std::optional<bool> is_regular_file(const utils::resource::resource_location& res_loc) const;
+
+    // Loads several files at once, the results follow the order of the locations.
+    // The default implementation loads the files one by one.
+    [[nodiscard]] virtual utils::value_task<std::vector<std::optional<std::string>>> load_texts(
+        std::vector<utils::resource::resource_location> document_locs) const;
 
 protected:
     ~external_file_reader() = default;
@@ -63,6 +70,8 @@ public:
     ~file_manager_impl();
 
     [[nodiscard]] utils::value_task<std::shared_ptr<file>> add_file(const utils::resource::resource_location&) override;
+    [[nodiscard]] utils::value_task<std::vector<std::shared_ptr<file>>> add_files(
+        std::vector<utils::resource::resource_location> file_names) override;
 
     std::shared_ptr<file> find(const utils::resource::resource_location& key) const override;
 
@@ -70,6 +79,7 @@ public:
         const utils::resource::resource_location& directory) const override;
     [[nodiscard]] utils::value_task<list_directory_result> list_directory_subdirs_and_symlinks(
         const utils::resource::resource_location& directory) const override;
+    std::optional<bool> is_regular_file(const utils::resource::resource_location& res_loc) const override;
 
     std::string canonical(const utils::resource::resource_location& res_loc, std::error_code& ec) const override;
 
@@ -92,6 +102,9 @@ public:
     [[nodiscard]] utils::value_task<std::optional<std::string>> get_converted_file_content(
         const utils::resource::resource_location&) override;
 
+    // Approximate size of the texts of all files kept in memory
+    std::size_t memory_usage() const;
+
 private:
     const external_file_reader* m_file_reader;
     const utils::text_convertor* m_text_convertor;
@@ -127,6 +140,8 @@ private:
 
     std::shared_ptr<mapped_file> try_obtaining_file_unsafe(
         const utils::resource::resource_location& file_name, const std::optional<std::string>* expected_text);
+    std::shared_ptr<mapped_file> emplace_loaded_file_unsafe(
+        const utils::resource::resource_location& file_name, std::optional<std::string>& loaded_text);
 
 protected:
     const auto& get_files() const { return m_files; }
@@ -15,6 +15,8 @@
 #ifndef HLASMPLUGIN_PARSERLIBRARY_LIBRARY_H
 #define HLASMPLUGIN_PARSERLIBRARY_LIBRARY_H
 
+#include <cstddef>
+#include <span>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -22,6 +24,7 @@
 namespace hlasm_plugin {
 namespace parser_library {
 struct diagnostic;
+enum class fs_change_type;
 } // namespace parser_library
 namespace utils::resource {
 class resource_location;
@@ -41,11 +44,17 @@ public:
     virtual ~library() = default;
     [[nodiscard]] virtual utils::task refresh() = 0;
     [[nodiscard]] virtual utils::task prefetch() = 0;
+    // Applies individual changes of watched files to the cached content.
+    // Returns false when the changes cannot be applied incrementally and the library must be refreshed.
+    virtual bool update_files(std::span<const utils::resource::resource_location> files,
+        std::span<const fs_change_type> changes) = 0;
     virtual std::vector<std::string> list_files() = 0;
     virtual const utils::resource::resource_location& get_location() const = 0;
     virtual bool has_file(std::string_view file, utils::resource::resource_location* url = nullptr) = 0;
     virtual void copy_diagnostics(std::vector<diagnostic>&) const = 0;
     virtual bool has_cached_content() const = 0;
+    // Approximate size of the cached index of library members
+    virtual std::size_t memory_usage() const = 0;
 };
 
 } // namespace hlasm_plugin::parser_library::workspaces
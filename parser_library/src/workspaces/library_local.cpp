@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <locale>
+#include <optional>
 #include <utility>
 
 #include "diagnostic_op.h"
@@ -24,6 +25,7 @@
 #include "utils/projectors.h"
 #include "utils/string_operations.h"
 #include "wildcard.h"
+#include "workspace_manager.h"
 
 namespace hlasm_plugin::parser_library::workspaces {
 
@@ -62,6 +64,7 @@ library_local::library_local(library_local&& l) noexcept
     : m_file_manager(l.m_file_manager)
     , m_lib_loc(std::move(l.m_lib_loc))
     , m_files_collection(l.m_files_collection.exchange(nullptr))
+    , m_generation(l.m_generation.load())
     , m_extensions(std::move(l.m_extensions))
     , m_optional(l.m_optional)
     , m_err_loc(std::move(l.m_err_loc))
@@ -69,7 +72,17 @@ library_local::library_local(library_local&& l) noexcept
 
 utils::task library_local::refresh()
 {
-    return m_file_manager.list_directory_files(m_lib_loc).then([this](auto res) { load_files(std::move(res)); });
+    for (;;)
+    {
+        const auto generation = m_generation.load();
+        auto res = co_await m_file_manager.list_directory_files(m_lib_loc);
+        // the listing may predate changes applied in the meantime
+        if (generation != m_generation.load())
+            continue;
+
+        load_files(std::move(res));
+        break;
+    }
 }
 
 utils::task library_local::prefetch()
@@ -80,6 +93,69 @@ utils::task library_local::prefetch()
         return refresh();
 }
 
+bool library_local::update_files(
+    std::span<const utils::resource::resource_location> files, std::span<const fs_change_type> changes)
+{
+    if (files.size() != changes.size())
+        return false;
+
+    const auto current = m_files_collection.load();
+    if (!current)
+        return true;
+
+    std::optional<std::vector<std::pair<std::string, utils::resource::resource_location>>> listing;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        const auto& rl = files[i];
+        // the library directory itself or one of its parents
+        if (m_lib_loc.is_prefix_of(rl))
+        {
+            ++m_generation;
+            return false;
+        }
+        if (utils::resource::resource_location::replace_filename(rl, "") != m_lib_loc)
+            continue;
+
+        if (changes[i] != fs_change_type::changed)
+            ++m_generation;
+
+        switch (changes[i])
+        {
+            case fs_change_type::changed:
+                break;
+
+            case fs_change_type::created:
+                if (current->listing_rc != utils::path::list_directory_rc::done)
+                    return false;
+                // only regular files are members, like in the full listing
+                if (const auto regular_file = m_file_manager.is_regular_file(rl); !regular_file.has_value())
+                    return false;
+                else if (!*regular_file)
+                    break;
+                if (!listing)
+                    listing.emplace(current->listing);
+                if (auto name = rl.filename();
+                    std::ranges::find(*listing, name, utils::first_element) == listing->end())
+                    listing->emplace_back(std::move(name), rl);
+                break;
+
+            case fs_change_type::deleted:
+                if (!listing)
+                    listing.emplace(current->listing);
+                std::erase_if(*listing, [name = rl.filename()](const auto& e) { return e.first == name; });
+                break;
+
+            default:
+                return false;
+        }
+    }
+
+    if (listing)
+        load_files({ std::move(*listing), current->listing_rc });
+
+    return true;
+}
+
 std::vector<std::string> library_local::list_files()
 {
     auto files = m_files_collection.load();
@@ -87,8 +163,8 @@ std::vector<std::string> library_local::list_files()
         return {};
 
     std::vector<std::string> result;
-    result.reserve(files->first.size());
-    std::ranges::transform(files->first, std::back_inserter(result), utils::first_element);
+    result.reserve(files->files.size());
+    std::ranges::transform(files->files, std::back_inserter(result), utils::first_element);
     return result;
 }
 
@@ -99,8 +175,8 @@ bool library_local::has_file(std::string_view file, utils::resource::resource_lo
     auto files = m_files_collection.load();
     if (!files)
         return {};
-    auto it = files->first.find(file);
-    if (it == files->first.end())
+    auto it = files->files.find(file);
+    if (it == files->files.end())
         return false;
 
     if (url)
@@ -112,22 +188,35 @@ bool library_local::has_file(std::string_view file, utils::resource::resource_lo
 void library_local::copy_diagnostics(std::vector<diagnostic>& target) const
 {
     if (auto files = m_files_collection.load(); files)
-        target.insert(target.end(), files->second.begin(), files->second.end());
+        target.insert(target.end(), files->diags.begin(), files->diags.end());
 }
 
 bool library_local::has_cached_content() const { return m_files_collection.load() != nullptr; }
 
+std::size_t library_local::memory_usage() const
+{
+    const auto files = m_files_collection.load();
+    if (!files)
+        return 0;
+
+    std::size_t result = sizeof(*files) + files->files.bucket_count() * sizeof(void*)
+        + files->diags.capacity() * sizeof(diagnostic)
+        + files->listing.capacity() * sizeof(decltype(files->listing)::value_type);
+    for (const auto& [name, loc] : files->files)
+        result += sizeof(name) + sizeof(loc) + 2 * sizeof(void*) + name.capacity() + loc.get_uri().size();
+    for (const auto& [name, loc] : files->listing)
+        result += name.capacity() + loc.get_uri().size();
+    return result;
+}
+
 library_local::files_collection_t library_local::load_files(
     std::pair<std::vector<std::pair<std::string, utils::resource::resource_location>>, utils::path::list_directory_rc>
         res)
 {
-    auto& [files_list, rc] = res;
-    auto new_state = std::make_shared<std::pair<std::unordered_map<std::string,
-                                                    utils::resource::resource_location,
-                                                    utils::hashers::string_hasher,
-                                                    std::equal_to<>>,
-        std::vector<diagnostic>>>();
-    auto& [new_files, new_diags] = *new_state;
+    auto new_state = std::make_shared<files_collection>();
+    auto& [new_files, new_diags, files_list, rc] = *new_state;
+    files_list = std::move(res.first);
+    rc = res.second;
 
     switch (rc)
     {
@@ -160,8 +249,10 @@ library_local::files_collection_t library_local::load_files(
         ++conflict_count;
     };
 
-    for (auto& [file, rl] : files_list)
+    for (const auto& [file_name, file_rl] : files_list)
     {
+        auto file = file_name;
+        auto rl = file_rl;
         if (m_extensions.empty())
         {
             // ".hidden" is not an extension ------v
@@ -18,6 +18,7 @@
 #include <atomic>
 #include <compare>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -67,6 +68,9 @@ public:
 
     [[nodiscard]] utils::task prefetch() override;
 
+    bool update_files(std::span<const utils::resource::resource_location> files,
+        std::span<const fs_change_type> changes) override;
+
     std::vector<std::string> list_files() override;
 
     bool has_file(std::string_view file, utils::resource::resource_location* url = nullptr) override;
@@ -75,12 +79,23 @@ public:
 
     bool has_cached_content() const override;
 
+    std::size_t memory_usage() const override;
+
 private:
-    using files_collection_t = std::shared_ptr<const std::pair<std::unordered_map<std::string,
-                                                                   utils::resource::resource_location,
-                                                                   utils::hashers::string_hasher,
-                                                                   std::equal_to<>>,
-        std::vector<diagnostic>>>;
+    struct files_collection
+    {
+        std::unordered_map<std::string,
+            utils::resource::resource_location,
+            utils::hashers::string_hasher,
+            std::equal_to<>>
+            files;
+        std::vector<diagnostic> diags;
+
+        // directory listing the index was built from
+        std::vector<std::pair<std::string, utils::resource::resource_location>> listing;
+        utils::path::list_directory_rc listing_rc;
+    };
+    using files_collection_t = std::shared_ptr<const files_collection>;
 #if __cpp_lib_atomic_shared_ptr >= 201711L
     using atomic_files_collection_t = std::atomic<files_collection_t>;
 #else
@@ -103,6 +118,8 @@ private:
 
     utils::resource::resource_location m_lib_loc;
     atomic_files_collection_t m_files_collection;
+    // counts the watched changes of the library directory, a listing started before a change is outdated
+    std::atomic<size_t> m_generation = 0;
     std::vector<std::string> m_extensions;
     bool m_optional = false;
     utils::resource::resource_location m_err_loc;
@@ -152,4 +152,38 @@ void macro_cache::save_macro(const macro_cache_key& key, const analyzer& analyze
         cache_data.cached_member = analyzer.context().hlasm_ctx->get_copy_member(key.name);
 }
 
+void macro_cache::clear() noexcept { cache_.clear(); }
+
+namespace {
+std::size_t block_memory_usage(const context::cached_block& block) noexcept
+{
+    std::size_t result = 0;
+    for (const auto& stmt : block)
+        result += stmt.memory_usage();
+    return result;
+}
+} // namespace
+
+std::size_t macro_cache::memory_usage() const noexcept
+{
+    std::size_t result = cache_.bucket_count() * sizeof(void*);
+    for (const auto& [key, data] : cache_)
+    {
+        result += sizeof(key) + sizeof(data) + key.opsyn_state.capacity() * sizeof(cached_opsyn_mnemo)
+            + data.stamps.size() * sizeof(version_stamp::value_type);
+
+        if (const auto* mi = std::get_if<lsp::macro_info_ptr>(&data.cached_member); mi && *mi)
+        {
+            if (const auto& def = (*mi)->macro_definition)
+                result += block_memory_usage(def->cached_definition);
+            for (const auto& [_, occ] : (*mi)->file_occurrences)
+                result += occ.symbols.capacity() * sizeof(lsp::symbol_occurrence)
+                    + occ.line_details.capacity() * sizeof(lsp::line_occurence_details);
+        }
+        else if (const auto* cm = std::get_if<context::copy_member_ptr>(&data.cached_member); cm && *cm)
+            result += block_memory_usage((*cm)->cached_definition);
+    }
+    return result;
+}
+
 } // namespace hlasm_plugin::parser_library::workspaces
@@ -111,7 +111,7 @@ struct macro_cache_data
     std::variant<lsp::macro_info_ptr, context::copy_member_ptr> cached_member;
 };
 
-// Macro cache is tied to a specific id_storage
+// Macro cache is tied to a specific id_storage, programs sharing it must use the same one
 class macro_cache final
 {
     std::unordered_map<macro_cache_key, macro_cache_data> cache_;
@@ -125,6 +125,10 @@ public:
     std::optional<std::vector<std::shared_ptr<file>>> load_from_cache(
         const macro_cache_key& key, const analyzing_context& ctx) const;
     void save_macro(const macro_cache_key& key, const analyzer& analyzer);
+    // Drops all cached members, they are parsed again when needed
+    void clear() noexcept;
+    // Approximate size of the cached members
+    std::size_t memory_usage() const noexcept;
 
 private:
     [[nodiscard]] const macro_cache_data* find_cached_data(const macro_cache_key& key) const;
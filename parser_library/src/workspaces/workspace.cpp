@@ -16,14 +16,19 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <map>
 #include <memory>
+#include <optional>
+#include <set>
+#include <string_view>
 #include <unordered_set>
 
 #include "analyzer.h"
 #include "completion_item.h"
 #include "completion_trigger_kind.h"
 #include "context/hlasm_context.h"
+#include "context/id_storage.h"
 #include "document_symbol_item.h"
 #include "fade_messages.h"
 #include "file.h"
@@ -33,8 +38,10 @@
 #include "lsp/item_convertors.h"
 #include "lsp/lsp_context.h"
 #include "macro_cache.h"
+#include "memory_stats.h"
 #include "output_handler.h"
 #include "parse_lib_provider.h"
+#include "processing/preprocessor_cache.h"
 #include "processing/statement_analyzers/hit_count_analyzer.h"
 #include "protocol.h"
 #include "semantics/highlighting_info.h"
@@ -44,6 +51,7 @@
 #include "utils/levenshtein_distance.h"
 #include "utils/path_conversions.h"
 #include "utils/projectors.h"
+#include "utils/string_operations.h"
 #include "utils/transform_inserter.h"
 
 using hlasm_plugin::utils::resource::resource_location;
@@ -52,11 +60,23 @@ namespace hlasm_plugin::parser_library::workspaces {
 
 struct workspace::dependency_cache
 {
-    dependency_cache(version_t version, const file_manager& fm, std::shared_ptr<file> file)
+    dependency_cache(version_t version,
+        asm_option opts,
+        index_t<processor_group, unsigned long long> group_id,
+        std::shared_ptr<context::id_storage> ids,
+        const file_manager& fm,
+        std::shared_ptr<file> file)
         : version(version)
+        , opts(std::move(opts))
+        , group_id(group_id)
+        , ids(std::move(ids))
         , cache(fm, std::move(file))
     {}
     version_t version;
+    asm_option opts;
+    // copy members used by the cached macros are resolved through the libraries of the group
+    index_t<processor_group, unsigned long long> group_id;
+    std::shared_ptr<context::id_storage> ids;
     macro_cache cache;
 };
 
@@ -64,6 +84,8 @@ struct workspace::processor_file_compoments
 {
     std::shared_ptr<file> m_file;
     std::unique_ptr<parsing_results> m_last_results = std::make_unique<parsing_results>();
+    std::shared_ptr<processing::preprocessor_cache> m_preprocessor_cache =
+        std::make_shared<processing::preprocessor_cache>();
 
     std::map<resource_location, std::variant<std::shared_ptr<dependency_cache>, virtual_file_handle>, std::less<>>
         m_dependencies;
@@ -77,6 +99,12 @@ struct workspace::processor_file_compoments
     bool m_last_opencode_analyzer_with_lsp = false;
     bool m_last_macro_analyzer_with_lsp = false;
     std::shared_ptr<context::id_storage> m_last_opencode_id_storage;
+    // Members fetched ahead of the analysis, held so that unused predictions are not fetched again on every reparse
+    std::vector<std::shared_ptr<file>> m_prefetched_members;
+
+    analysis_fidelity m_pending_fidelity = analysis_fidelity::diagnostics;
+    analysis_fidelity m_last_fidelity = analysis_fidelity::full;
+    unsigned long long m_last_used = 0;
 
     index_t<processor_group, unsigned long long> m_group_id;
 
@@ -87,6 +115,16 @@ struct workspace::processor_file_compoments
     [[nodiscard]] utils::task update_source_if_needed(file_manager& fm);
 };
 
+struct mac_cpybook_definition_details
+{
+    bool cpy_book = false;
+    size_t end_line;
+    size_t prototype_line = 0;
+};
+
+using mac_cpy_definitions_map = std::map<size_t, mac_cpybook_definition_details, std::greater<size_t>>;
+using rl_mac_cpy_map = std::unordered_map<resource_location, mac_cpy_definitions_map>;
+
 struct parsing_results
 {
     semantics::lines_info hl_info;
@@ -96,6 +134,8 @@ struct parsing_results
     std::vector<std::pair<virtual_file_handle, utils::resource::resource_location>> vf_handles;
     processing::hit_count_map hc_opencode_map;
     processing::hit_count_map hc_macro_map;
+    // macro and copy member definitions needed for fading, retained when lsp_context is dropped
+    rl_mac_cpy_map mac_cpy_definitions;
 
     std::vector<diagnostic> opencode_diagnostics;
     std::vector<diagnostic> macro_diagnostics;
@@ -108,9 +148,13 @@ struct parsing_results
     parse_lib_provider& lib_provider,
     asm_option asm_opts,
     std::vector<preprocessor_options> pp,
+    std::shared_ptr<processing::preprocessor_cache> pp_cache,
     external_functions_list ef,
-    virtual_file_monitor* vfm)
+    virtual_file_monitor* vfm,
+    analysis_fidelity fidelity)
 {
+    const bool full = fidelity == analysis_fidelity::full;
+
     struct output_t final : output_handler
     {
         std::vector<output_line> lines;
@@ -128,10 +172,12 @@ struct parsing_results
             file->get_location(),
             &lib_provider,
             std::move(asm_opts),
-            collect_highlighting_info::yes,
+            full ? collect_highlighting_info::yes : collect_highlighting_info::no,
+            full ? collect_occurrences_info::yes : collect_occurrences_info::no,
             file_is_opencode::yes,
             std::move(ids),
             std::move(pp),
+            std::move(pp_cache),
             std::move(ef),
             vfm,
             fms,
@@ -157,11 +203,73 @@ struct parsing_results
     co_return result;
 }
 
+namespace {
+// Options that may influence parsing of macros and copy members, the program-specific ones are excluded
+asm_option dependency_options(const asm_option& opts)
+{
+    auto result = opts;
+    result.sysin_dsn.clear();
+    result.sysin_member.clear();
+    return result;
+}
+
+// Collects operation codes and COPY operands that may name library members.
+// The scan is approximate, it only predicts which members are worth loading ahead of the analysis.
+void collect_member_candidates(std::string_view text, std::vector<std::string>& names)
+{
+    constexpr size_t continuation_column = 71;
+    constexpr size_t max_name_length = 63;
+    constexpr auto valid_name = [](std::string_view name) {
+        return !name.empty() && name.size() <= max_name_length && std::ranges::all_of(name, [](unsigned char c) {
+            return std::isalnum(c) || c == '@' || c == '#' || c == '$' || c == '_';
+        });
+    };
+    // built-in instructions are resolved before the libraries are consulted
+    constexpr auto instruction = [](std::string_view name) {
+        return instructions::find_machine_instructions(name) || instructions::find_mnemonic_codes(name)
+            || instructions::find_assembler_instructions(name) || instructions::find_ca_instructions(name);
+    };
+
+    bool continued = false;
+    while (!text.empty())
+    {
+        auto line = text.substr(0, text.find('\n'));
+        text.remove_prefix(std::min(line.size() + 1, text.size()));
+        if (line.ends_with('\r'))
+            line.remove_suffix(1);
+
+        if (std::exchange(continued, line.size() > continuation_column && line[continuation_column] != ' '))
+            continue;
+        if (line.empty() || line.starts_with('*') || line.starts_with(".*"))
+            continue;
+
+        line = line.substr(0, continuation_column);
+        const auto next_field = [&line]() {
+            line.remove_prefix(std::min(line.find_first_not_of(' '), line.size()));
+            const auto field = line.substr(0, line.find_first_of(" ,"));
+            line.remove_prefix(field.size());
+            return field;
+        };
+
+        if (!line.starts_with(' '))
+            line.remove_prefix(std::min(line.find(' '), line.size()));
+
+        auto name = utils::to_upper_copy(next_field());
+        if (name == "COPY")
+            name = utils::to_upper_copy(next_field());
+
+        if (valid_name(name) && !instruction(name))
+            names.push_back(std::move(name));
+    }
+}
+} // namespace
+
 struct workspace_parse_lib_provider final : public parse_lib_provider
 {
     file_manager& fm;
     workspace& ws;
     std::vector<std::shared_ptr<library>> libraries;
+    index_t<processor_group, unsigned long long> group_id;
     workspace::processor_file_compoments& pfc;
 
     std::map<resource_location,
@@ -174,10 +282,12 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
     workspace_parse_lib_provider(file_manager& fm,
         workspace& ws,
         std::vector<std::shared_ptr<library>> libraries,
+        index_t<processor_group, unsigned long long> group_id,
         workspace::processor_file_compoments& pfc)
         : fm(fm)
         , ws(ws)
         , libraries(std::move(libraries))
+        , group_id(group_id)
         , pfc(pfc)
     {}
 
@@ -191,23 +301,21 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
             utils::first_element);
     }
 
+    resource_location find_member(std::string_view library) const
+    {
+        if (resource_location url;
+            std::ranges::any_of(libraries, [&url, &library](const auto& lib) { return lib->has_file(library, &url); }))
+            return url;
+        else
+            return resource_location();
+    }
+
     resource_location get_url(std::string_view library)
     {
         if (auto it = next_member_map.find(library); it != next_member_map.end())
-        {
             return it->second;
-        }
-        else if (resource_location url;
-            std::ranges::none_of(libraries, [&url, &library](const auto& lib) { return lib->has_file(library, &url); }))
-        {
-            next_member_map.emplace(library, resource_location());
-            return resource_location();
-        }
         else
-        {
-            next_member_map.emplace(library, url);
-            return url;
-        }
+            return next_member_map.emplace(library, find_member(library)).first->second;
     }
 
     [[nodiscard]] utils::value_task<std::shared_ptr<file>> get_file(const resource_location& url)
@@ -218,17 +326,21 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
             co_return current_file_map.try_emplace(url, co_await ws.file_manager_.add_file(url)).first->second;
     }
 
-    auto& get_cache(const resource_location& url, const std::shared_ptr<file>& file)
+    auto& get_cache(const resource_location& url, const std::shared_ptr<file>& file, const asm_option& opts)
     {
         return std::get<std::shared_ptr<workspace::dependency_cache>>(
             next_dependencies
-                .try_emplace(url, utils::factory([&url, &file, this]() {
+                .try_emplace(url, utils::factory([&url, &file, &opts, this]() {
                     auto version = file->get_version();
-                    if (auto it = pfc.m_dependencies.find(url); it != pfc.m_dependencies.end()
-                        && std::get<std::shared_ptr<workspace::dependency_cache>>(it->second)->version == version)
-                        return std::get<std::shared_ptr<workspace::dependency_cache>>(it->second);
-
-                    return std::make_shared<workspace::dependency_cache>(version, fm, file);
+                    if (auto it = pfc.m_dependencies.find(url); it != pfc.m_dependencies.end())
+                    {
+                        const auto& cache = std::get<std::shared_ptr<workspace::dependency_cache>>(it->second);
+                        if (cache->version == version && cache->opts == opts && cache->group_id == group_id
+                            && cache->ids == pfc.m_last_opencode_id_storage)
+                            return cache;
+                    }
+
+                    return ws.get_dependency_cache(url, file, opts, group_id, pfc.m_last_opencode_id_storage);
                 }))
                 .first->second)
             ->cache;
@@ -249,7 +361,8 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
 
         auto cache_key = macro_cache_key::create_from_context(*ctx.hlasm_ctx, kind, ctx.hlasm_ctx->add_id(library));
 
-        auto& mc = get_cache(url, file);
+        const auto opts = dependency_options(ctx.hlasm_ctx->options());
+        auto& mc = get_cache(url, file, opts);
 
         if (auto files = mc.load_from_cache(cache_key, ctx); files.has_value())
         {
@@ -257,7 +370,7 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
             {
                 // carry-over nested copy dependencies
                 current_file_map.try_emplace(f->get_location(), f);
-                (void)get_cache(f->get_location(), f);
+                (void)get_cache(f->get_location(), f, opts);
             }
 
             co_return true;
@@ -323,6 +436,52 @@ struct workspace_parse_lib_provider final : public parse_lib_provider
 
         return utils::task::wait_all(std::move(pending_prefetches));
     }
+
+    bool has_remote_libraries() const
+    {
+        return std::ranges::any_of(libraries, [](const auto& lib) { return !lib->get_location().is_local(); });
+    }
+
+    // Loads the members the program is likely to use from remote libraries in bulk, one round per nesting level,
+    // instead of requesting them one at a time while the analysis is suspended
+    [[nodiscard]] utils::task prefetch_members(std::string_view text)
+    {
+        constexpr size_t max_rounds = 8;
+
+        std::vector<std::string> names;
+        collect_member_candidates(text, names);
+
+        // members held from the previous parse are obtained without reading them again unless they changed
+        std::vector<std::shared_ptr<file>> prefetched;
+
+        std::set<std::string, std::less<>> seen;
+        for (size_t round = 0; round < max_rounds && !names.empty(); ++round)
+        {
+            std::vector<resource_location> urls;
+            for (auto& name : names)
+            {
+                const auto [it, inserted] = seen.insert(std::move(name));
+                if (!inserted)
+                    continue;
+                if (auto url = find_member(*it); !url.empty() && !url.is_local() && !current_file_map.contains(url))
+                    urls.push_back(std::move(url));
+            }
+            names.clear();
+
+            if (urls.empty())
+                break;
+
+            for (auto& file : co_await fm.add_files(std::move(urls)))
+            {
+                if (!file->error())
+                    collect_member_candidates(file->get_text(), names);
+                prefetched.push_back(file);
+                current_file_map.try_emplace(file->get_location(), std::move(file));
+            }
+        }
+
+        pfc.m_prefetched_members = std::move(prefetched);
+    }
 };
 
 workspace::workspace(file_manager& file_manager, configuration_provider& configuration)
@@ -333,6 +492,42 @@ workspace::workspace(file_manager& file_manager, configuration_provider& configu
 
 workspace::~workspace() = default;
 
+std::shared_ptr<workspace::dependency_cache> workspace::get_dependency_cache(const resource_location& url,
+    const std::shared_ptr<file>& file,
+    const asm_option& opts,
+    index_t<processor_group, unsigned long long> group_id,
+    const std::shared_ptr<context::id_storage>& ids)
+{
+    const auto version = file->get_version();
+    auto& caches = m_dependency_caches[url];
+
+    std::erase_if(caches, [](const auto& c) { return c.expired(); });
+
+    for (const auto& c : caches)
+    {
+        if (auto cache = c.lock();
+            cache->version == version && cache->opts == opts && cache->group_id == group_id && cache->ids == ids)
+            return cache;
+    }
+
+    auto cache = std::make_shared<dependency_cache>(version, opts, group_id, ids, file_manager_, file);
+    caches.emplace_back(cache);
+
+    return cache;
+}
+
+void workspace::release_expired_dependency_caches()
+{
+    for (auto it = m_dependency_caches.begin(); it != m_dependency_caches.end();)
+    {
+        std::erase_if(it->second, [](const auto& c) { return c.expired(); });
+        if (it->second.empty())
+            it = m_dependency_caches.erase(it);
+        else
+            ++it;
+    }
+}
+
 std::unordered_map<utils::resource::resource_location, std::vector<utils::resource::resource_location>>
 workspace::report_used_configuration_files() const
 {
@@ -363,15 +558,6 @@ void workspace::produce_diagnostics(std::vector<diagnostic>& target) const
 }
 
 namespace {
-struct mac_cpybook_definition_details
-{
-    bool cpy_book = false;
-    size_t end_line;
-    size_t prototype_line = 0;
-};
-
-using mac_cpy_definitions_map = std::map<size_t, mac_cpybook_definition_details, std::greater<size_t>>;
-using rl_mac_cpy_map = std::unordered_map<resource_location, mac_cpy_definitions_map>;
 
 void generate_merged_fade_messages(const resource_location& rl,
     const processing::hit_count_entry& hc_entry,
@@ -386,50 +572,63 @@ void generate_merged_fade_messages(const resource_location& rl,
         active_rl_mac_cpy_map_it != active_rl_mac_cpy_map.end())
         active_mac_cpy_defs_map = &active_rl_mac_cpy_map_it->second;
 
-    const auto line_details_it_b = hc_entry.details.begin();
-    const auto line_details_it_e = hc_entry.details.end();
+    // macro body lines are faded only when the macro definition is active
+    const auto active_macro_line = [active_mac_cpy_defs_map, &hc_entry](size_t lineno) {
+        if (!active_mac_cpy_defs_map)
+            return false;
 
-    const auto faded_line_predicate = [active_mac_cpy_defs_map,
-                                          line_details_addr = std::to_address(line_details_it_b),
-                                          &hc_entry](const processing::line_detail& e) {
-        if (e.macro_body)
-        {
-            if (!active_mac_cpy_defs_map)
-                return false;
-
-            auto lineno = static_cast<size_t>(std::ranges::distance(line_details_addr, &e));
-            auto active_mac_cpy_it_e = active_mac_cpy_defs_map->end();
-
-            auto active_mac_cpy_it = std::find_if(active_mac_cpy_defs_map->lower_bound(lineno),
-                active_mac_cpy_it_e,
-                [lineno](const std::pair<size_t, mac_cpybook_definition_details>& mac_cpy_def) {
-                    const auto& [active_mac_cpy_start_line, active_mac_cpy_def_detail] = mac_cpy_def;
-                    return lineno >= active_mac_cpy_start_line && lineno <= active_mac_cpy_def_detail.end_line;
-                });
-
-            if (active_mac_cpy_it == active_mac_cpy_it_e
-                || (!active_mac_cpy_it->second.cpy_book && !hc_entry.contains_prototype(active_mac_cpy_it->first)))
-                return false;
-        }
+        auto active_mac_cpy_it_e = active_mac_cpy_defs_map->end();
 
-        return e.contains_statement && e.count == 0;
-    };
+        auto active_mac_cpy_it = std::find_if(active_mac_cpy_defs_map->lower_bound(lineno),
+            active_mac_cpy_it_e,
+            [lineno](const std::pair<size_t, mac_cpybook_definition_details>& mac_cpy_def) {
+                const auto& [active_mac_cpy_start_line, active_mac_cpy_def_detail] = mac_cpy_def;
+                return lineno >= active_mac_cpy_start_line && lineno <= active_mac_cpy_def_detail.end_line;
+            });
 
-    const auto it_b =
-        std::ranges::find_if(line_details_it_b, line_details_it_e, &processing::line_detail::contains_statement);
-    auto faded_line_it = std::find_if(it_b, line_details_it_e, faded_line_predicate);
+        return active_mac_cpy_it != active_mac_cpy_it_e
+            && (active_mac_cpy_it->second.cpy_book || hc_entry.contains_prototype(active_mac_cpy_it->first));
+    };
 
-    while (faded_line_it != line_details_it_e)
-    {
-        auto active_line = std::find_if_not(std::next(faded_line_it), line_details_it_e, faded_line_predicate);
+    std::optional<size_t> faded_start;
+    const auto flush = [&faded_start, &fms, &rl](size_t end) {
+        if (!faded_start)
+            return;
         fms.emplace_back(fade_message::inactive_statement(rl.get_uri(),
             range {
-                position(utils::to_unsigned(std::ranges::distance(line_details_it_b, faded_line_it)), 0),
-                position(utils::to_unsigned(std::ranges::distance(line_details_it_b, std::prev(active_line))), 80),
+                position(*faded_start, 0),
+                position(end - 1, 80),
             }));
+        faded_start.reset();
+    };
 
-        faded_line_it = std::find_if(active_line, line_details_it_e, faded_line_predicate);
+    size_t line = 0;
+    for (const auto& [end, detail] : hc_entry.runs())
+    {
+        if (!detail.contains_statement || detail.count != 0)
+        {
+            flush(line);
+            line = end;
+            continue;
+        }
+
+        if (!detail.macro_body)
+        {
+            if (!faded_start)
+                faded_start = line;
+            line = end;
+            continue;
+        }
+
+        for (; line < end; ++line)
+        {
+            if (!active_macro_line(line))
+                flush(line);
+            else if (!faded_start)
+                faded_start = line;
+        }
     }
+    flush(line);
 }
 
 void filter_and_emplace_hc_map(
@@ -444,8 +643,9 @@ void filter_and_emplace_hc_map(
         to_hc_it->second.merge(from_hc_entry);
 }
 
+// Collects definitions located in rl, or all of them when rl is not provided
 void filter_and_emplace_mac_cpy_definitions(
-    rl_mac_cpy_map& active_rl_mac_cpy_map, const lsp::lsp_context* lsp_ctx, const resource_location& rl)
+    rl_mac_cpy_map& active_rl_mac_cpy_map, const lsp::lsp_context* lsp_ctx, const resource_location* rl)
 {
     if (!lsp_ctx)
         return;
@@ -455,10 +655,10 @@ void filter_and_emplace_mac_cpy_definitions(
         if (!mac_info_ptr || !mac_info_ptr->macro_definition)
             continue;
 
-        const auto mac_definition_emplacer = [&active_rl_mac_cpy_map, &rl](const auto& definition,
-                                                 bool cpy_book) -> mac_cpybook_definition_details* {
+        const auto mac_definition_emplacer = [&active_rl_mac_cpy_map, rl](const auto& definition,
+                                                bool cpy_book) -> mac_cpybook_definition_details* {
             const auto& def_location = definition->definition_location;
-            if (def_location.resource_loc != rl)
+            if (rl && def_location.resource_loc != *rl)
                 return nullptr;
 
             const auto& lines = definition->cached_definition;
@@ -470,7 +670,7 @@ void filter_and_emplace_mac_cpy_definitions(
             if (!first_line || !last_line)
                 return nullptr;
 
-            return &active_rl_mac_cpy_map[rl]
+            return &active_rl_mac_cpy_map[def_location.resource_loc]
                         .emplace(def_location.pos.line,
                             mac_cpybook_definition_details { cpy_book, last_line->statement_position().line })
                         .first->second;
@@ -488,6 +688,13 @@ void filter_and_emplace_mac_cpy_definitions(
     }
 }
 
+void filter_and_emplace_mac_cpy_definitions(
+    rl_mac_cpy_map& active_rl_mac_cpy_map, const rl_mac_cpy_map& retained, const resource_location& rl)
+{
+    if (auto it = retained.find(rl); it != retained.end())
+        active_rl_mac_cpy_map[rl].insert(it->second.begin(), it->second.end());
+}
+
 void fade_unused_mac_names(const processing::hit_count_map& hc_map,
     const rl_mac_cpy_map& active_rl_mac_cpy_map,
     std::vector<fade_message>& fms)
@@ -535,8 +742,11 @@ void workspace::retrieve_fade_messages(std::vector<fade_message>& fms) const
             filter_and_emplace_hc_map(hc_map, proc_file_component.m_last_results->hc_macro_map, *opened_file_rl);
             if (take_also_opencode_hc)
                 filter_and_emplace_hc_map(hc_map, proc_file_component.m_last_results->hc_opencode_map, *opened_file_rl);
-            filter_and_emplace_mac_cpy_definitions(
-                active_rl_mac_cpy_map, proc_file_component.m_last_results->lsp_context.get(), *opened_file_rl);
+            if (const auto* lsp_ctx = proc_file_component.m_last_results->lsp_context.get())
+                filter_and_emplace_mac_cpy_definitions(active_rl_mac_cpy_map, lsp_ctx, opened_file_rl);
+            else
+                filter_and_emplace_mac_cpy_definitions(
+                    active_rl_mac_cpy_map, proc_file_component.m_last_results->mac_cpy_definitions, *opened_file_rl);
         }
     }
 
@@ -593,36 +803,58 @@ utils::value_task<parse_file_result> workspace::parse_file(resource_location* se
     if (m_parsing_pending.empty())
         return {};
 
-    const auto& file_to_parse = *m_parsing_pending.begin();
+    // programs with full analysis requested are likely to be queried soon
+    auto pending = std::ranges::find_if(m_parsing_pending, [this](const auto& rl) {
+        return m_processor_files.at(rl).m_pending_fidelity == analysis_fidelity::full;
+    });
+    if (pending == m_parsing_pending.end())
+        pending = m_parsing_pending.begin();
+
+    const auto& file_to_parse = *pending;
     if (selected)
         *selected = file_to_parse;
     processor_file_compoments& comp = m_processor_files.at(file_to_parse);
 
     assert(comp.m_opened);
 
-    if (!comp.m_last_opencode_id_storage)
-        comp.m_last_opencode_id_storage = context::hlasm_context::make_default_id_storage();
-
     return [](processor_file_compoments& comp, workspace& self) -> utils::value_task<parse_file_result> {
         const auto& url = comp.m_file->get_location();
 
         auto [config, proc_grp_id] = co_await self.m_configuration.get_analyzer_configuration(url);
 
         comp.m_alternative_config = std::move(config.alternative_config_url);
-        workspace_parse_lib_provider ws_lib(self.file_manager_, self, std::move(config.libraries), comp);
+        workspace_parse_lib_provider ws_lib(
+            self.file_manager_, self, std::move(config.libraries), proc_grp_id, comp);
 
         if (auto prefetch = ws_lib.prefetch_libraries(); prefetch.valid())
             co_await std::move(prefetch);
+        // local members are read on demand, the text is not scanned for them
+        if (ws_lib.has_remote_libraries())
+            co_await ws_lib.prefetch_members(comp.m_file->get_text());
+        else
+            comp.m_prefetched_members.clear();
 
         bool collect_perf_metrics = comp.m_collect_perf_metrics;
+        const auto fidelity = comp.m_pending_fidelity;
+
+        // join the identifiers of the other live programs, start afresh once none is left
+        if (comp.m_last_opencode_id_storage = self.m_id_storage.lock(); !comp.m_last_opencode_id_storage)
+            self.m_id_storage = comp.m_last_opencode_id_storage = context::hlasm_context::make_default_id_storage();
 
         auto results = co_await parse_one_file(comp.m_last_opencode_id_storage,
             comp.m_file,
             ws_lib,
             std::move(config.opts),
             std::move(config.pp_opts),
+            comp.m_preprocessor_cache,
             std::move(config.external_functions),
-            &self.fm_vfm_);
+            &self.fm_vfm_,
+            fidelity);
+        // the text of the program did not change, previous semantic tokens remain usable until a full analysis
+        if (fidelity != analysis_fidelity::full)
+            results.hl_info = std::move(comp.m_last_results->hl_info);
+        comp.m_last_fidelity = fidelity;
+        comp.m_last_used = ++self.m_use_counter;
         results.hc_macro_map = std::move(comp.m_last_results->hc_macro_map); // save macro stuff
         results.macro_diagnostics = std::move(comp.m_last_results->macro_diagnostics);
         const bool outputs_changed = comp.m_last_results->outputs != results.outputs;
@@ -636,6 +868,8 @@ utils::value_task<parse_file_result> workspace::parse_file(resource_location* se
         comp.m_group_id = proc_grp_id;
 
         self.filter_and_close_dependencies(std::move(files_to_close));
+        self.release_expired_dependency_caches();
+        self.enforce_memory_budget();
 
         auto [errors, warnings] = std::pair<size_t, size_t>();
         for (const auto& d : comp.m_last_results->opencode_diagnostics)
@@ -662,9 +896,136 @@ bool trigger_reparse(const resource_location& file_location) { return !file_loca
 
 void workspace::mark_all_opened_files()
 {
-    for (const auto& [fname, comp] : m_processor_files)
+    for (auto& [_, comp] : m_processor_files)
+        if (comp.m_opened)
+            mark_pending(comp, analysis_fidelity::full);
+}
+
+void workspace::mark_pending(processor_file_compoments& comp, analysis_fidelity fidelity)
+{
+    if (m_parsing_pending.emplace(comp.m_file->get_location()).second)
+        comp.m_pending_fidelity = fidelity;
+    else
+        comp.m_pending_fidelity = std::max(comp.m_pending_fidelity, fidelity);
+}
+
+void workspace::request_full_analysis(const resource_location& document_loc)
+{
+    // only the program answering the queries is upgraded, see find_related_opencodes
+    const auto opencodes = find_related_opencodes(document_loc);
+    if (opencodes.empty())
+        return;
+
+    const auto& rl = opencodes.back()->m_file->get_location();
+    auto& comp = m_processor_files.at(rl);
+    if (!comp.m_opened)
+        return;
+
+    comp.m_last_used = ++m_use_counter;
+    if (comp.m_last_fidelity == analysis_fidelity::full && !m_parsing_pending.contains(rl))
+        return;
+
+    mark_pending(comp, analysis_fidelity::full);
+}
+
+namespace {
+std::size_t memory_usage(const processing::hit_count_map& hc_map) noexcept
+{
+    std::size_t result = hc_map.bucket_count() * sizeof(void*);
+    for (const auto& [_, e] : hc_map)
+        result += sizeof(processing::hit_count_map::value_type) + e.runs().capacity() * sizeof(processing::line_run);
+    return result;
+}
+
+std::size_t memory_usage(const std::vector<diagnostic>& diags) noexcept
+{
+    std::size_t result = diags.capacity() * sizeof(diagnostic);
+    for (const auto& d : diags)
+        result += d.message.capacity() + d.related.capacity() * sizeof(diagnostic_related_info);
+    return result;
+}
+
+std::size_t retained_size(const parsing_results& r) noexcept
+{
+    std::size_t result = r.hl_info.capacity() * sizeof(token_info) + memory_usage(r.hc_opencode_map);
+    if (r.lsp_context)
+        result += r.lsp_context->memory_usage();
+    return result;
+}
+} // namespace
+
+void workspace::collect_memory_stats(memory_stats& stats) const
+{
+    if (const auto ids = m_id_storage.lock())
+        stats.id_storage += ids->memory_usage();
+
+    for (const auto& [_, caches] : m_dependency_caches)
+    {
+        for (const auto& c : caches)
+        {
+            if (const auto cache = c.lock())
+                stats.macro_caches += sizeof(dependency_cache) + cache->cache.memory_usage();
+        }
+    }
+
+    for (const auto& [rl, comp] : m_processor_files)
+    {
+        const auto& r = *comp.m_last_results;
+        stats.files.push_back({
+            .uri = std::string(rl.get_uri()),
+            .lsp_context = r.lsp_context ? r.lsp_context->memory_usage() : 0,
+            .semantic_tokens = r.hl_info.capacity() * sizeof(token_info),
+            .hit_counts = memory_usage(r.hc_opencode_map) + memory_usage(r.hc_macro_map),
+            .diagnostics = memory_usage(r.opencode_diagnostics) + memory_usage(r.macro_diagnostics),
+            .preprocessor_cache = comp.m_preprocessor_cache->memory_usage(),
+        });
+    }
+}
+
+void workspace::enforce_memory_budget()
+{
+    if (m_memory_budget == 0)
+        return;
+
+    std::size_t total = 0;
+    std::vector<processor_file_compoments*> candidates;
+    for (auto& [_, comp] : m_processor_files)
+    {
+        if (comp.m_last_fidelity == analysis_fidelity::none)
+            continue;
+        total += retained_size(*comp.m_last_results);
         if (comp.m_opened)
-            m_parsing_pending.emplace(fname);
+            candidates.push_back(&comp);
+    }
+    if (total <= m_memory_budget || candidates.size() < 2)
+        return;
+
+    std::ranges::sort(candidates, {}, &processor_file_compoments::m_last_used);
+    candidates.pop_back(); // the most recently used program stays
+
+    for (auto* comp : candidates)
+    {
+        if (total <= m_memory_budget)
+            break;
+
+        auto& results = *comp->m_last_results;
+        const auto retained = retained_size(results);
+
+        // diagnostics, outputs and fade messages are small and reported for all open programs, the hit counts and
+        // definitions of macros and copy members stay to keep the inactive code faded
+        filter_and_emplace_mac_cpy_definitions(results.mac_cpy_definitions, results.lsp_context.get(), nullptr);
+        results.lsp_context.reset();
+        results.hl_info = {};
+        total -= retained - retained_size(results);
+        comp->m_last_fidelity = analysis_fidelity::none;
+        comp->m_preprocessor_cache->clear();
+
+        for (auto& [__, dep] : comp->m_dependencies)
+        {
+            if (auto* cache = std::get_if<std::shared_ptr<dependency_cache>>(&dep); cache && cache->use_count() == 1)
+                (*cache)->cache.clear();
+        }
+    }
 }
 
 utils::task workspace::mark_file_for_parsing(
@@ -684,13 +1045,13 @@ utils::task workspace::mark_file_for_parsing(
             if (!component.m_opened)
                 continue;
             if (component.m_dependencies.contains(file_location))
-                m_parsing_pending.emplace(component.m_file->get_location());
+                mark_pending(component, analysis_fidelity::diagnostics);
         }
     }
 
     if (auto it = m_processor_files.find(file_location); it != m_processor_files.end() && it->second.m_opened)
     {
-        m_parsing_pending.emplace(it->second.m_file->get_location());
+        mark_pending(it->second, analysis_fidelity::full);
         return it->second.update_source_if_needed(file_manager_);
     }
 
@@ -703,7 +1064,7 @@ void workspace::external_configuration_invalidated(const resource_location& url)
     if (url.empty())
         mark_all_opened_files();
     else if (auto it = m_processor_files.find(url); it != m_processor_files.end() && it->second.m_opened)
-        m_parsing_pending.emplace(url);
+        mark_pending(it->second, analysis_fidelity::full);
 }
 
 workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
@@ -714,7 +1075,9 @@ workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
     workspace_file_info ws_file_info;
 
     comp.m_collect_perf_metrics = false; // only on open/first parsing
-    m_parsing_pending.erase(comp.m_file->get_location());
+    // a full analysis may have been requested while a reduced one was running
+    if (comp.m_pending_fidelity <= comp.m_last_fidelity)
+        m_parsing_pending.erase(comp.m_file->get_location());
 
     ws_file_info.processor_group_found = has_processor_group;
     if (!has_processor_group && std::cmp_greater(comp.m_last_results->opencode_diagnostics.size(), diag_suppress_limit))
@@ -728,6 +1091,23 @@ workspace_file_info workspace::parse_successful(processor_file_compoments& comp,
     comp.m_last_results->vf_handles.clear();
 
     ws_file_info.files_processed = libs.next_dependencies.size() + 1; // TODO: identify error states?
+    if (m_report_dependencies)
+    {
+        std::set<std::string, std::less<>> dependencies;
+        for (const auto& [url, dep] : libs.next_dependencies)
+            if (std::holds_alternative<std::shared_ptr<dependency_cache>>(dep))
+                dependencies.emplace(url.get_uri());
+        // preprocessor includes and failed lookups are only present in the member map
+        for (const auto& [name, url] : libs.next_member_map)
+        {
+            if (!url.empty())
+                dependencies.emplace(url.get_uri());
+            ws_file_info.library_lookups.push_back({ name, std::string(url.get_uri()) });
+        }
+        ws_file_info.dependencies.assign(dependencies.begin(), dependencies.end());
+        for (const auto& lib : libs.libraries)
+            ws_file_info.libraries.emplace_back(lib->get_location().get_uri());
+    }
 
     comp.m_dependencies = std::move(libs.next_dependencies);
     comp.m_member_map = std::move(libs.next_member_map);
@@ -740,7 +1120,7 @@ utils::task workspace::did_open_file(resource_location file_location, file_conte
     auto& file = co_await add_processor_file_impl(co_await file_manager_.add_file(file_location));
     file.m_opened = true;
     file.m_collect_perf_metrics = true;
-    m_parsing_pending.emplace(file_location);
+    mark_pending(file, analysis_fidelity::full);
     if (auto t = mark_file_for_parsing(file_location, file_content_status); t.valid())
         co_await std::move(t);
 }
@@ -791,6 +1171,7 @@ utils::task workspace::did_close_file(resource_location file_location)
 
     // close the file itself
     m_processor_files.erase(fcomp);
+    release_expired_dependency_caches();
 }
 
 utils::task workspace::did_change_watched_files(std::vector<resource_location> file_locations,
@@ -813,13 +1194,13 @@ utils::task workspace::did_change_watched_files(std::vector<resource_location> f
     }
     if (changed_groups)
     {
-        for (const auto& [_, comp] : m_processor_files)
+        for (auto& [_, comp] : m_processor_files)
         {
             if (!comp.m_opened)
                 continue;
 
             if (std::ranges::find(*changed_groups, comp.m_group_id) != changed_groups->end())
-                m_parsing_pending.emplace(comp.m_file->get_location());
+                mark_pending(comp, analysis_fidelity::full);
         }
     }
     return utils::task::wait_all(std::move(pending_updates));
@@ -49,8 +49,12 @@ struct completion_item;
 enum class completion_trigger_kind;
 struct document_symbol_item;
 struct fade_message;
+struct memory_stats;
 class external_configuration_requests;
 } // namespace hlasm_plugin::parser_library
+namespace hlasm_plugin::parser_library::context {
+class id_storage;
+} // namespace hlasm_plugin::parser_library::context
 namespace hlasm_plugin::parser_library::workspaces {
 class file_manager;
 class library;
@@ -68,6 +72,14 @@ struct parse_file_result
     size_t warnings = 0;
     bool outputs_changed = false;
 };
+// Level of detail collected when a program is parsed. Programs reparsed only because one of their dependencies
+// changed are analyzed for diagnostics and fading, semantic tokens and symbol occurrences are collected on demand.
+enum class analysis_fidelity : unsigned char
+{
+    none, // results were dropped to stay within the memory budget
+    diagnostics,
+    full,
+};
 // Represents a LSP workspace. It solves all dependencies between files -
 // implements parse lib provider and decides which files are to be parsed
 // when a particular file has been changed in the editor.
@@ -129,6 +141,18 @@ public:
 
     void external_configuration_invalidated(const resource_location& url);
 
+    // Schedules full reparse of the document and of the programs using it, when last analyzed with reduced fidelity
+    void request_full_analysis(const resource_location& document_loc);
+
+    // Results of the least recently used programs are dropped when their estimated size exceeds the budget
+    void set_memory_budget(std::size_t bytes) noexcept { m_memory_budget = bytes; }
+
+    // Library members and lookups of analyzed programs are listed in their workspace_file_info
+    void set_dependency_reporting(bool enabled) noexcept { m_report_dependencies = enabled; }
+
+    // Adds estimated sizes of the retained analysis results to stats
+    void collect_memory_stats(memory_stats& stats) const;
+
     std::unordered_map<utils::resource::resource_location, std::vector<utils::resource::resource_location>>
     report_used_configuration_files() const;
 
@@ -150,7 +174,26 @@ private:
     struct processor_file_compoments;
 
     std::unordered_map<resource_location, processor_file_compoments> m_processor_files;
+
+    // Identifiers are shared by all live programs, so that parsed macros and copy members can be reused between them.
+    // Owned by the programs and their dependency caches, released together with the last of them.
+    std::weak_ptr<context::id_storage> m_id_storage;
+    // Dependency caches of all programs, reused whenever the file version, assembler options and processor group match
+    std::unordered_map<resource_location, std::vector<std::weak_ptr<dependency_cache>>> m_dependency_caches;
+
+    std::shared_ptr<dependency_cache> get_dependency_cache(const resource_location& url,
+        const std::shared_ptr<file>& file,
+        const asm_option& opts,
+        index_t<processor_group, unsigned long long> group_id,
+        const std::shared_ptr<context::id_storage>& ids);
+    void release_expired_dependency_caches();
     std::unordered_set<resource_location> m_parsing_pending;
+    void mark_pending(processor_file_compoments& comp, analysis_fidelity fidelity);
+
+    std::size_t m_memory_budget = 0;
+    bool m_report_dependencies = false;
+    unsigned long long m_use_counter = 0;
+    void enforce_memory_budget();
 
     [[nodiscard]] utils::value_task<processor_file_compoments&> add_processor_file_impl(std::shared_ptr<file> f);
     const processor_file_compoments* find_processor_file_impl(const resource_location& file) const;
@@ -558,6 +558,14 @@ bool workspace_configuration::is_b4g_config_file(const utils::resource::resource
     return file.filename() == B4G_CONF_FILE;
 }
 
+std::size_t workspace_configuration::libraries_memory_usage() const
+{
+    std::size_t result = 0;
+    for (const auto& [_, entry] : m_libraries)
+        result += entry.lib->memory_usage();
+    return result;
+}
+
 lib_config load_from_pgm_config(const config::pgm_conf& config)
 {
     lib_config loaded;
@@ -996,7 +1004,8 @@ utils::value_task<parse_config_file_result> workspace_configuration::parse_confi
 }
 
 utils::value_task<std::optional<std::vector<index_t<processor_group, unsigned long long>>>>
-workspace_configuration::refresh_libraries(const std::vector<utils::resource::resource_location>& file_locations)
+workspace_configuration::refresh_libraries(
+    const std::vector<utils::resource::resource_location>& file_locations, std::span<const fs_change_type> changes)
 {
     using return_type = std::optional<std::vector<index_t<processor_group, unsigned long long>>>;
     return_type result;
@@ -1033,6 +1042,8 @@ workspace_configuration::refresh_libraries(const std::vector<utils::resource::re
         {
             if (!refreshed_libs.emplace(std::to_address(lib)).second || !lib->has_cached_content())
                 continue;
+            if (lib->update_files(file_locations, changes))
+                continue;
             if (auto refresh = lib->refresh(); refresh.valid() && !refresh.done())
             {
                 pending_refreshes.emplace_back(std::move(refresh));
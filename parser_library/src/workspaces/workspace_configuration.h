@@ -44,6 +44,7 @@
 namespace hlasm_plugin::parser_library {
 struct asm_option;
 class external_configuration_requests;
+enum class fs_change_type;
 } // namespace hlasm_plugin::parser_library
 namespace hlasm_plugin::parser_library::workspaces {
 using global_settings_map =
@@ -333,13 +334,17 @@ public:
 
     bool settings_updated() const;
     [[nodiscard]] utils::value_task<std::optional<std::vector<index_t<processor_group, unsigned long long>>>>
-    refresh_libraries(const std::vector<utils::resource::resource_location>& file_locations);
+    refresh_libraries(const std::vector<utils::resource::resource_location>& file_locations,
+        std::span<const fs_change_type> changes = {});
 
     void produce_diagnostics(std::vector<diagnostic>& target,
         const std::unordered_map<utils::resource::resource_location, std::vector<utils::resource::resource_location>>&
             used_configs_opened_files_map,
         bool include_advisory_cfg_diags) const;
 
+    // Approximate size of the indexes of all libraries
+    std::size_t libraries_memory_usage() const;
+
     const processor_group& get_proc_grp(const proc_grp_id& p) const; // test only
 
     [[nodiscard]] utils::task update_external_configuration(
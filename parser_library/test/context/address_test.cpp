@@ -105,3 +105,37 @@ TEST(address, subtract_optimization)
 
     EXPECT_THAT(diff.bases(), Pointwise(Eq(), expected_bases));
 }
+
+TEST(address, merge_bases)
+{
+    hlasm_context ctx;
+    auto sect1 = ctx.ord_ctx.set_section(id_index("TEST1"), section_kind::COMMON, library_info_transitional::empty);
+    auto sect2 = ctx.ord_ctx.set_section(id_index("TEST2"), section_kind::COMMON, library_info_transitional::empty);
+    auto sect3 = ctx.ord_ctx.set_section(id_index("TEST3"), section_kind::COMMON, library_info_transitional::empty);
+
+    address addr1({ id_index(), sect1 }, 10, {});
+    address addr2({ id_index(), sect2 }, 20, {});
+    address addr3({ id_index(), sect3 }, 30, {});
+
+    auto diff = addr1 - addr2;
+    EXPECT_EQ(diff.offset(), -10);
+    EXPECT_EQ(diff.bases().size(), 2);
+    EXPECT_TRUE(diff.is_complex());
+
+    auto neg = -diff;
+    EXPECT_EQ(neg.offset(), 10);
+
+    auto sum = diff + neg;
+    EXPECT_TRUE(sum.bases().empty());
+    EXPECT_EQ(sum.offset(), 0);
+
+    auto complex = diff + addr3 + addr3;
+    EXPECT_EQ(complex.offset(), 50);
+    ASSERT_EQ(complex.bases().size(), 3);
+    EXPECT_EQ(std::ranges::count(complex.bases(), 2, &address::base_entry::cardinality), 1);
+
+    auto back = complex - addr3 - addr3 + addr2;
+    EXPECT_TRUE(back.is_simple());
+    EXPECT_EQ(back.bases().front().owner, sect1);
+    EXPECT_EQ(back.offset(), 10);
+}
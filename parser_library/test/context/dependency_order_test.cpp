@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "context/id_index.h"
+#include "context/ordinary_assembly/dependency_order.h"
+
+// test for
+// dependency_order class
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::context;
+
+namespace {
+constexpr id_index ids[] = { id_index("A"), id_index("B"), id_index("C"), id_index("D") };
+} // namespace
+
+TEST(dependency_order, chain)
+{
+    dependency_order order;
+
+    EXPECT_TRUE(order.add(ids[0], std::vector<dependant_ref> { ids[1] }));
+    EXPECT_TRUE(order.add(ids[2], std::vector<dependant_ref> { ids[0] }));
+    EXPECT_TRUE(order.add(ids[1], std::vector<dependant_ref> { ids[3] }));
+
+    EXPECT_TRUE(order.contains(ids[0], ids[1]));
+    EXPECT_FALSE(order.contains(ids[1], ids[0]));
+}
+
+TEST(dependency_order, cycle)
+{
+    dependency_order order;
+
+    EXPECT_TRUE(order.add(ids[0], std::vector<dependant_ref> { ids[1] }));
+    EXPECT_TRUE(order.add(ids[1], std::vector<dependant_ref> { ids[2] }));
+    EXPECT_FALSE(order.add(ids[2], std::vector<dependant_ref> { ids[0] }));
+
+    EXPECT_FALSE(order.contains(ids[2], ids[0]));
+    EXPECT_TRUE(order.valid());
+}
+
+TEST(dependency_order, reorder)
+{
+    dependency_order order;
+
+    EXPECT_TRUE(order.add(ids[0], std::vector<dependant_ref> { ids[1] }));
+    EXPECT_TRUE(order.add(ids[2], std::vector<dependant_ref> { ids[3] }));
+    // requires moving the first chain behind the second one
+    EXPECT_TRUE(order.add(ids[3], std::vector<dependant_ref> { ids[0] }));
+
+    EXPECT_FALSE(order.add(ids[1], std::vector<dependant_ref> { ids[2] }));
+}
+
+TEST(dependency_order, removed_dependency)
+{
+    dependency_order order;
+
+    EXPECT_TRUE(order.add(ids[0], std::vector<dependant_ref> { ids[1] }));
+    order.remove(ids[0]);
+
+    EXPECT_FALSE(order.contains(ids[0], ids[1]));
+    EXPECT_TRUE(order.add(ids[1], std::vector<dependant_ref> { ids[0] }));
+}
+
+TEST(dependency_order, attributes)
+{
+    dependency_order order;
+
+    EXPECT_TRUE(order.add(attr_ref { data_attr_kind::L, ids[0] }, std::vector<dependant_ref> { ids[0] }));
+    EXPECT_FALSE(order.add(ids[0], std::vector<dependant_ref> { attr_ref { data_attr_kind::L, ids[0] } }));
+}
+
+TEST(dependency_order, failed_add_rolled_back)
+{
+    dependency_order order;
+
+    EXPECT_TRUE(order.add(ids[0], std::vector<dependant_ref> { ids[1] }));
+    EXPECT_FALSE(order.add(ids[0], std::vector<dependant_ref> { ids[2], ids[0] }));
+
+    EXPECT_TRUE(order.contains(ids[0], ids[1]));
+    EXPECT_FALSE(order.contains(ids[0], ids[2]));
+    EXPECT_EQ(order.size(), 2);
+
+    EXPECT_FALSE(order.add(ids[3], std::vector<dependant_ref> { ids[2], ids[3] }));
+    EXPECT_EQ(order.size(), 2);
+}
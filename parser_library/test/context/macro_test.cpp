@@ -658,6 +658,46 @@ TEST(variable_argument_passing, positive_sublist)
     EXPECT_TRUE(dynamic_cast<const macro_param_data_single*>(data->get_ith(8)));
 }
 
+TEST(variable_argument_passing, deferred_sublist)
+{
+    constexpr auto parse = [](std::string s) {
+        diagnostic_adder diags;
+        return macro_processor::string_to_macrodata(std::move(s), diags);
+    };
+
+    for (std::string s : { "(a,(b,1),((c),1))", "()", "(a,)", "(a(1),(1,(1))b,()c())", "(a" })
+    {
+        diagnostic_adder diags;
+        const auto eager = macro_processor::string_to_macrodata(s, diags);
+        const macro_param_data_deferred deferred(s, +parse);
+
+        EXPECT_EQ(deferred.get_value(), eager->get_value()) << s;
+        EXPECT_EQ(deferred.number(), eager->number()) << s;
+        EXPECT_EQ(deferred.index_range(), eager->index_range()) << s;
+        EXPECT_EQ(deferred.is_sublist(), eager->is_sublist()) << s;
+        for (A_t i = 0; i <= eager->number() + 1; ++i)
+            EXPECT_EQ(deferred.get_ith(i)->get_value(), eager->get_ith(i)->get_value()) << s;
+    }
+}
+
+TEST(variable_argument_passing, deferred_sublist_in_macro)
+{
+    std::string input = R"(
+      MACRO
+      MAC  &P
+&N    SETA N'&P
+&K    SETA K'&P
+      MNOTE 0,'&P &P(2) &P(3,1) &N &K'
+      MEND
+
+      MAC  (A,B,(C,D))
+)";
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(matches_message_text(a.diags(), { "(A,B,(C,D)) B C 3 11" }));
+}
+
 TEST(variable_argument_passing, negative_sublist)
 {
     diagnostic_adder diags;
@@ -1652,3 +1692,52 @@ TEST(macro, defines_seq_symbol_only_in_opencode)
 
     EXPECT_TRUE(matches_message_codes(a.diags(), { "E047" }));
 }
+
+TEST(macro, variable_reference_shared_by_macros)
+{
+    mock_parse_lib_provider lib({
+        { "COPYBOOK", R"(
+      MNOTE 0,'&X'
+)" },
+    });
+    std::string input = R"(
+      MACRO
+      MAC1 &X
+      COPY COPYBOOK
+      MEND
+
+      MACRO
+      MAC2
+      LCLC &X
+&X    SETC 'LOCAL'
+      COPY COPYBOOK
+      MEND
+
+      MAC1 A
+      MAC2
+      MAC1 B
+)";
+    analyzer a(input, analyzer_options(&lib));
+    a.analyze();
+
+    EXPECT_TRUE(matches_message_text(a.diags(), { "A", "LOCAL", "B" }));
+}
+
+TEST(macro, variable_references_in_nested_invocations)
+{
+    std::string input = R"(
+      MACRO
+      REC  &N
+      AIF  (&N EQ 0).END
+&M    SETA &N-1
+      REC  &M
+      MNOTE 0,'&N &M'
+.END  MEND
+
+      REC  2
+)";
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(matches_message_text(a.diags(), { "1 0", "2 1" }));
+}
@@ -547,3 +547,44 @@ X   EQU   1
 
     EXPECT_EQ(get_symbol_abs(a.hlasm_ctx(), "L"), 8);
 }
+
+TEST(ordinary_symbols, long_dependency_chain)
+{
+    constexpr size_t chain_length = 100000;
+
+    std::string input(R"(
+S   CSECT
+X   DS    (A0)C
+Y   DS    C
+    ORG   X+A0/2
+Z   DS    C
+    ORG
+)");
+    for (size_t i = 0; i + 1 < chain_length; ++i)
+        input.append("A").append(std::to_string(i)).append(" EQU A").append(std::to_string(i + 1)).append("+1\n");
+    input.append("A").append(std::to_string(chain_length - 1)).append(" EQU 1\n");
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+
+    EXPECT_EQ(get_symbol_abs(a.hlasm_ctx(), "A0"), static_cast<int32_t>(chain_length));
+    EXPECT_EQ(get_symbol_address(a.hlasm_ctx(), "Y"), std::pair(static_cast<int>(chain_length), std::string("S")));
+    EXPECT_EQ(get_symbol_address(a.hlasm_ctx(), "Z"), std::pair(static_cast<int>(chain_length / 2), std::string("S")));
+}
+
+TEST(ordinary_symbols, long_cyclic_dependency_chain)
+{
+    constexpr size_t chain_length = 1000;
+
+    std::string input;
+    for (size_t i = 1; i < chain_length; ++i)
+        input.append("A").append(std::to_string(i)).append(" EQU A").append(std::to_string(i - 1)).append("+1\n");
+    input.append("A0 EQU A").append(std::to_string(chain_length - 1)).append("\n");
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(matches_message_codes(a.diags(), { "E033" }));
+}
@@ -65,6 +65,25 @@ TEST_F(debug_lib_provider_test, parse_library)
     EXPECT_TRUE(matches_message_codes(a.diags(), { "MNOTE" }));
 }
 
+TEST_F(debug_lib_provider_test, members_retained)
+{
+    const std::string aaa_content = " MNOTE 'AAA'";
+    const resource_location aaa_location("AAA");
+    EXPECT_CALL(fm_mock, get_converted_file_content(Eq(aaa_location))).WillOnce(Invoke(get_file_cortn(aaa_content)));
+    EXPECT_CALL(*mock_lib, has_file(Eq("AAA"), _)).WillOnce(DoAll(SetArgPointee<1>(aaa_location), Return(true)));
+    EXPECT_CALL(*mock_lib, has_file(Eq("BBB"), _)).WillOnce(Return(false));
+
+    // repeated analyses neither look the members up again nor read them again
+    for (int i = 0; i < 2; ++i)
+    {
+        std::string input = " COPY AAA\n COPY BBB";
+        analyzer a(input, analyzer_options(&lib));
+        analyze(a);
+
+        EXPECT_TRUE(matches_message_codes(a.diags(), { "MNOTE", "E058" }));
+    }
+}
+
 TEST_F(debug_lib_provider_test, has_library)
 {
     EXPECT_CALL(*mock_lib, has_file(Eq("AAA"), _)).WillOnce(Return(true));
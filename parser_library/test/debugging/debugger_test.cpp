@@ -419,6 +419,12 @@ public:
             }
             hlasm_plugin::utils::task prefetch() override { return {}; }
 
+            bool update_files(std::span<const resource_location>, std::span<const fs_change_type>) override
+            {
+                assert(false);
+                return false;
+            }
+
             std::vector<std::string> list_files() override
             {
                 assert(false);
@@ -444,6 +450,8 @@ public:
 
             bool has_cached_content() const override { return false; }
 
+            std::size_t memory_usage() const override { return 0; }
+
             debugger_mock_library(file_manager& fm)
                 : fm(fm)
             {}
@@ -1270,6 +1278,234 @@ TEST(debugger, function_breakpoints)
     d.disconnect();
 }
 
+TEST(debugger, breakpoint_in_continued_statement)
+{
+    std::string open_code = "\n    LR 1,1\n" + std::string("    LR 1,").append(71 - 9, ' ') + "X\n               2\n";
+
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager, .libraries = {}, .opts = {}, .pp_opts = {} });
+    }));
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+
+    const resource_location file_loc("test");
+
+    file_manager.did_open_file(file_loc, 0, open_code);
+
+    std::vector<breakpoint> bps { breakpoint(7), breakpoint(3), breakpoint(3) };
+    d.breakpoints(file_loc.get_uri(), bps);
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_loc.get_uri(), dc_provider, false, resp);
+
+    m.wait_for_stopped();
+
+    EXPECT_EQ(m.get_last_reason(), "breakpoint");
+    auto frames = d.stack_frames();
+    ASSERT_EQ(frames.size(), 1U);
+    EXPECT_EQ(frames[0].begin_line, 2U);
+
+    d.breakpoints(file_loc.get_uri(), {});
+    EXPECT_TRUE(d.breakpoints(file_loc.get_uri()).empty());
+
+    d.continue_debug();
+    m.wait_for_exited();
+}
+
+TEST(debugger, reverse_execution)
+{
+    std::string open_code = R"(
+    MNOTE 1,'FIRST'
+    LR 1,1
+    MNOTE 2,'SECOND'
+    LR 2,2
+)";
+
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager, .libraries = {}, .opts = {}, .pp_opts = {} });
+    }));
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+
+    const resource_location file_loc("test");
+
+    file_manager.did_open_file(file_loc, 0, open_code);
+
+    std::vector<breakpoint> bps { breakpoint(2), breakpoint(4) };
+    d.breakpoints(file_loc.get_uri(), bps);
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_loc.get_uri(), dc_provider, false, resp);
+
+    const auto current_line = [&d]() {
+        auto frames = d.stack_frames();
+        return frames.empty() ? (size_t)-1 : frames.front().begin_line;
+    };
+
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "breakpoint");
+    EXPECT_EQ(current_line(), 2U);
+
+    d.continue_debug();
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "breakpoint");
+    EXPECT_EQ(current_line(), 4U);
+    EXPECT_EQ(m.get_last_mnote(), std::make_pair((unsigned char)2, std::string("SECOND")));
+
+    d.step_back();
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "step");
+    EXPECT_EQ(current_line(), 3U);
+
+    d.reverse_continue();
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "breakpoint");
+    EXPECT_EQ(current_line(), 2U);
+
+    d.step_back();
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "step");
+    EXPECT_EQ(current_line(), 1U);
+
+    d.step_back();
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "step");
+    EXPECT_EQ(current_line(), 1U);
+
+    // replayed statements do not produce the outputs again
+    EXPECT_EQ(m.get_last_mnote(), std::make_pair((unsigned char)2, std::string("SECOND")));
+
+    d.continue_debug();
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "breakpoint");
+    EXPECT_EQ(current_line(), 2U);
+    EXPECT_EQ(m.get_last_mnote(), std::make_pair((unsigned char)1, std::string("FIRST")));
+
+    d.disconnect();
+}
+
+TEST(debugger, reverse_execution_replays_time)
+{
+    std::string open_code = R"(
+         MACRO
+         MAC
+         LR 1,1
+         LR 2,2
+         MEND
+         MAC
+)";
+
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager, .libraries = {}, .opts = {}, .pp_opts = {} });
+    }));
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+
+    const resource_location file_loc("test");
+
+    file_manager.did_open_file(file_loc, 0, open_code);
+
+    std::vector<breakpoint> bps { breakpoint(3) };
+    d.breakpoints(file_loc.get_uri(), bps);
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_loc.get_uri(), dc_provider, false, resp);
+
+    m.wait_for_stopped();
+    const auto clock = d.evaluate("&SYSCLOCK");
+    const auto time = d.evaluate("&SYSTIME");
+    EXPECT_FALSE(clock.error);
+
+    d.step_in();
+    m.wait_for_stopped();
+
+    d.step_back();
+    m.wait_for_stopped();
+    ASSERT_FALSE(d.stack_frames().empty());
+    EXPECT_EQ(d.stack_frames().front().begin_line, 3U);
+
+    // stepping from the restored statement replays the analysis
+    d.step_in();
+    m.wait_for_stopped();
+    ASSERT_FALSE(d.stack_frames().empty());
+    EXPECT_EQ(d.stack_frames().front().begin_line, 4U);
+
+    // the replayed macro invocation observes the same time
+    EXPECT_EQ(d.evaluate("&SYSCLOCK").result, clock.result);
+    EXPECT_EQ(d.evaluate("'&SYSTIME'").result, time.result);
+
+    d.disconnect();
+}
+
+TEST(debugger, reverse_execution_restores_checkpoint)
+{
+    std::string open_code = R"(
+&A  SETA 1
+&A  SETA 2
+&A  SETA 3
+)";
+
+    file_manager_impl file_manager;
+    NiceMock<debugger_configuration_provider_mock> dc_provider;
+    EXPECT_CALL(dc_provider, provide_debugger_configuration).WillRepeatedly(Invoke([&file_manager](auto, auto r) {
+        r.provide({ .fm = &file_manager, .libraries = {}, .opts = {}, .pp_opts = {} });
+    }));
+    debugger d;
+    debug_event_consumer_s_mock m(d);
+
+    const resource_location file_loc("test");
+
+    file_manager.did_open_file(file_loc, 0, open_code);
+
+    auto [resp, mock] = make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<bool>>);
+    EXPECT_CALL(*mock, provide(true));
+    d.launch(file_loc.get_uri(), dc_provider, true, resp);
+
+    const auto current_line = [&d]() {
+        auto frames = d.stack_frames();
+        return frames.empty() ? (size_t)-1 : frames.front().begin_line;
+    };
+
+    m.wait_for_stopped();
+    d.step_in();
+    m.wait_for_stopped();
+    d.step_in();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 3U);
+    EXPECT_EQ(d.evaluate("&A").result, "2");
+
+    // the recorded state is shown without replaying the analysis
+    d.step_back();
+    m.wait_for_stopped();
+    EXPECT_EQ(m.get_last_reason(), "step");
+    EXPECT_EQ(current_line(), 2U);
+    EXPECT_EQ(d.evaluate("&A").result, "1");
+    EXPECT_TRUE(d.evaluate("&A+1").error);
+
+    const auto scopes = d.scopes(0);
+    ASSERT_EQ(scopes.size(), 3U);
+    const auto locals = d.variables(scopes[1].var_reference);
+    ASSERT_EQ(std::ranges::count(locals, "&A", &variable::name), 1);
+    EXPECT_EQ(std::ranges::find(locals, "&A", &variable::name)->value, "1");
+
+    d.step_in();
+    m.wait_for_stopped();
+    EXPECT_EQ(current_line(), 3U);
+    EXPECT_EQ(d.evaluate("&A").result, "2");
+    EXPECT_EQ(d.evaluate("&A+1").result, "3");
+
+    d.disconnect();
+}
+
 TEST(debugger, invalid_file)
 {
     file_manager_impl file_manager;
@@ -453,3 +453,46 @@ TEST(arithmetic_expressions, different_var_types)
 
     EXPECT_TRUE(matches_message_codes(a.diags(), { "CE004" }));
 }
+
+TEST(arithmetic_expressions, constant_subexpressions)
+{
+    std::string input =
+        R"(
+&V    SETA 5
+&A1   SETA 2*3+1
+&A2   SETA -(4/2)*&V
+&A3   SETA ((1+1) SLL 2)
+&A4   SETA &V+(X'10'-C'A'+193)
+&C(3) SETC 'A','B','C'
+&A5   SETA K'&C(3+1)
+&B    SETB (2*2 EQ 4)
+)";
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "A1"), 7);
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "A2"), -10);
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "A3"), 8);
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "A4"), 21);
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "A5"), 1);
+    EXPECT_EQ(get_var_value<B_t>(a.hlasm_ctx(), "B"), true);
+}
+
+TEST(arithmetic_expressions, constant_overflow_reported_per_evaluation)
+{
+    std::string input =
+        R"(
+    MACRO
+    MAC
+&A  SETA 2147483647+1
+    MEND
+
+    MAC
+    MAC
+)";
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(matches_message_codes(a.diags(), { "CE013", "CE013" }));
+}
@@ -48,7 +48,15 @@ std::ostream& operator<<(std::ostream& stream, const performance_metrics& item)
                   << "\n macro statements: " << item.macro_statements
                   << "\n non continued statements: " << item.non_continued_statements
                   << "\n open code statements: " << item.open_code_statements
-                  << "\n reparsed statements: " << item.reparsed_statements << "\n";
+                  << "\n reparsed statements: " << item.reparsed_statements
+                  << "\n open code opcode cache hits: " << item.open_code_opcode_cache_hits
+                  << "\n open code opcode cache misses: " << item.open_code_opcode_cache_misses
+                  << "\n macro opcode cache hits: " << item.macro_opcode_cache_hits
+                  << "\n macro opcode cache misses: " << item.macro_opcode_cache_misses
+                  << "\n copy opcode cache hits: " << item.copy_opcode_cache_hits
+                  << "\n copy opcode cache misses: " << item.copy_opcode_cache_misses
+                  << "\n lookahead opcode cache hits: " << item.lookahead_opcode_cache_hits
+                  << "\n lookahead opcode cache misses: " << item.lookahead_opcode_cache_misses << "\n";
 }
 
 } // namespace hlasm_plugin::parser_library
@@ -155,6 +155,39 @@ TEST_F(benchmark_test, reparsed_statements)
     EXPECT_EQ(a->get_metrics().reparsed_statements, (size_t)4);
 }
 
+TEST_F(benchmark_test, reparsed_statements_reused)
+{
+    setUpAnalyzer(" MAC 1\n MAC 1\n");
+    // model statement in MAC produces the same operands in both invocations
+    EXPECT_EQ(a->get_metrics().reparsed_statements, (size_t)2);
+
+    setUpAnalyzer(" MAC 1\n MAC 2\n");
+    EXPECT_EQ(a->get_metrics().reparsed_statements, (size_t)3);
+}
+
+TEST_F(benchmark_test, opcode_cache)
+{
+    setUpAnalyzer(" LR 1,1\n LR 1,1\n LR 1,1\n");
+    // repeated lookups of the same opcode are answered by the cache
+    EXPECT_GE(a->get_metrics().open_code_opcode_cache_hits, (size_t)2);
+    const auto misses = a->get_metrics().open_code_opcode_cache_misses;
+
+    setUpAnalyzer(" LR 1,1\n LR 1,1\n LR 1,1\nLR OPSYN AR\n LR 1,1\n");
+    // OPSYN invalidates the cached lookups
+    EXPECT_GT(a->get_metrics().open_code_opcode_cache_misses, misses);
+    EXPECT_TRUE(a->diags().empty());
+}
+
+TEST_F(benchmark_test, opcode_cache_phases)
+{
+    setUpAnalyzer(" MAC 1\n AGO .HERE\n LR 1,1\n.HERE ANOP\n COPY COPYFILE");
+    const auto& m = a->get_metrics();
+    EXPECT_GT(m.open_code_opcode_cache_hits + m.open_code_opcode_cache_misses, 0U);
+    EXPECT_GT(m.macro_opcode_cache_hits + m.macro_opcode_cache_misses, 0U);
+    EXPECT_GT(m.copy_opcode_cache_hits + m.copy_opcode_cache_misses, 0U);
+    EXPECT_GT(m.lookahead_opcode_cache_hits + m.lookahead_opcode_cache_misses, 0U);
+}
+
 TEST_F(benchmark_test, lookahead_statements)
 {
     setUpAnalyzer(" AGO .HERE\n something\n something\n.HERE ANOP");
@@ -616,3 +616,33 @@ TEST(copy, invalid_quotes_on_operandless)
 
     EXPECT_TRUE(a.diags().empty());
 }
+
+TEST(copy, macros_share_reparsed_copy_statements)
+{
+    mock_parse_lib_provider libs { { "MEMBER", R"(
+    LR  1,1
+    DC  F'1'
+)" } };
+    const auto reparsed = [&libs](std::string_view second_call) {
+        std::string input = R"(
+    MACRO
+    M1
+    COPY MEMBER
+    MEND
+    MACRO
+    M2
+    COPY MEMBER
+    MEND
+    M1
+)";
+        input.append(second_call).append("\n");
+
+        analyzer a(input, analyzer_options(&libs));
+        a.analyze();
+
+        EXPECT_TRUE(a.diags().empty());
+        return a.get_metrics().reparsed_statements;
+    };
+
+    EXPECT_EQ(reparsed("    M1"), reparsed("    M2"));
+}
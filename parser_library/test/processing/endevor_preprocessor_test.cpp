@@ -90,6 +90,31 @@ TEST_F(endevor_preprocessor_test, basic_include)
     EXPECT_EQ(result.at(0).text(), "TEST");
 }
 
+TEST_F(endevor_preprocessor_test, included_lines_not_copied)
+{
+    auto p = create_preprocessor([](std::string_view) {
+        return std::pair<std::string, hlasm_plugin::utils::resource::resource_location>(
+            "LINE 1 OF THE INCLUDED MEMBER\nLINE 2 OF THE INCLUDED MEMBER\n",
+            hlasm_plugin::utils::resource::resource_location("AAA"));
+    });
+
+    auto result = p->generate_replacement(document("-INC AAA\nBBB")).run().value();
+
+    const auto& members = p->view_included_members();
+    ASSERT_EQ(members.size(), 1);
+    ASSERT_EQ(result.size(), 3);
+
+    const std::string_view member_text = members.front()->text;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        const auto line = result.at(i).text();
+        EXPECT_FALSE(result.at(i).is_original());
+        EXPECT_GE(line.data(), member_text.data());
+        EXPECT_LE(line.data() + line.size(), member_text.data() + member_text.size());
+    }
+    EXPECT_EQ(result.at(2).lineno(), 1);
+}
+
 TEST_F(endevor_preprocessor_test, missing_member)
 {
     auto p = create_preprocessor([&callback_count = m_callback_count](std::string_view s) {
@@ -1555,3 +1555,25 @@ A        DS    F
 
     EXPECT_TRUE(a.diags().empty());
 }
+
+TEST(lookahead, exhausted_scan_reused)
+{
+    std::string input = R"(
+&T1      SETC  T'X
+&T2      SETC  T'Y
+&T3      SETC  T'Z
+&L       SETA  L'W
+W        DS    CL4
+         END
+)";
+
+    analyzer a(input);
+    a.analyze();
+
+    EXPECT_TRUE(a.diags().empty());
+    EXPECT_EQ(get_var_value<C_t>(a.hlasm_ctx(), "T1"), "U");
+    EXPECT_EQ(get_var_value<C_t>(a.hlasm_ctx(), "T2"), "U");
+    EXPECT_EQ(get_var_value<C_t>(a.hlasm_ctx(), "T3"), "U");
+    EXPECT_EQ(get_var_value<A_t>(a.hlasm_ctx(), "L"), 4);
+    EXPECT_EQ(a.hlasm_ctx().metrics.lookahead_statements, 5);
+}
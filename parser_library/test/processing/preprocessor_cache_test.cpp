@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../common_testing.h"
+#include "../mock_parse_lib_provider.h"
+#include "analyzer.h"
+#include "diagnostic_consumer.h"
+#include "document.h"
+#include "preprocessor_options.h"
+#include "processing/preprocessor.h"
+#include "processing/preprocessor_cache.h"
+#include "semantics/source_info_processor.h"
+#include "semantics/statement.h"
+#include "utils/resource_location.h"
+
+using namespace hlasm_plugin::parser_library::processing;
+using namespace hlasm_plugin::utils::resource;
+
+class preprocessor_cache_test : public testing::Test
+{
+public:
+    preprocessor_cache_test()
+        : m_src_info(false)
+    {}
+
+    std::unique_ptr<preprocessor> create_preprocessor(
+        std::vector<preprocessor_options> opts = { endevor_preprocessor_options() })
+    {
+        return preprocessor_cache::create_preprocessor(
+            m_cache,
+            std::move(opts),
+            [this](std::string s)
+                -> hlasm_plugin::utils::value_task<std::optional<std::pair<std::string, resource_location>>> {
+                ++m_fetches;
+                if (auto it = m_members.find(s); it != m_members.end())
+                    co_return std::pair(it->second, resource_location(s));
+                co_return std::nullopt;
+            },
+            &m_diags,
+            m_src_info);
+    }
+
+    auto run(std::string_view text, std::vector<preprocessor_options> opts = { endevor_preprocessor_options() })
+    {
+        auto p = create_preprocessor(std::move(opts));
+        auto doc = p->generate_replacement(document(text)).run().value();
+        return std::pair(std::move(p), std::move(doc));
+    }
+
+protected:
+    std::shared_ptr<preprocessor_cache> m_cache = std::make_shared<preprocessor_cache>();
+    std::map<std::string, std::string, std::less<>> m_members = { { "AAA", "MEMBER LINE\n" } };
+    semantics::source_info_processor m_src_info;
+    diagnostic_op_consumer_container m_diags;
+    int m_fetches = 0;
+};
+
+TEST_F(preprocessor_cache_test, unchanged_program_replayed)
+{
+    const std::string text1 = "-INC AAA\nBBB\n";
+    const std::string text2 = text1;
+
+    auto [p1, doc1] = run(text1);
+    const auto stmts1 = p1->take_statements();
+    auto [p2, doc2] = run(text2);
+    const auto stmts2 = p2->take_statements();
+
+    EXPECT_EQ(m_fetches, 2);
+
+    ASSERT_EQ(stmts1.size(), 1);
+    ASSERT_EQ(stmts2.size(), 1);
+    EXPECT_EQ(stmts1.front(), stmts2.front());
+
+    ASSERT_EQ(p2->view_included_members().size(), 1);
+    EXPECT_EQ(p1->view_included_members().front(), p2->view_included_members().front());
+
+    ASSERT_EQ(doc1.size(), 2);
+    ASSERT_EQ(doc2.size(), 2);
+    EXPECT_EQ(doc2.at(0).text(), "MEMBER LINE\n");
+    EXPECT_FALSE(doc2.at(0).is_original());
+    EXPECT_EQ(doc2.at(1).text(), "BBB\n");
+    EXPECT_EQ(doc2.at(1).lineno(), 1);
+    // original lines refer to the text being analyzed
+    EXPECT_EQ(doc2.at(1).text().data(), text2.data() + 9);
+}
+
+TEST_F(preprocessor_cache_test, changed_member_reprocessed)
+{
+    auto [p1, doc1] = run("-INC AAA\nBBB\n");
+    const auto stmts1 = p1->take_statements();
+
+    m_members["AAA"] = "OTHER LINE\n";
+
+    auto [p2, doc2] = run("-INC AAA\nBBB\n");
+    const auto stmts2 = p2->take_statements();
+
+    ASSERT_EQ(stmts1.size(), 1);
+    ASSERT_EQ(stmts2.size(), 1);
+    EXPECT_NE(stmts1.front(), stmts2.front());
+
+    ASSERT_EQ(doc2.size(), 2);
+    EXPECT_EQ(doc2.at(0).text(), "OTHER LINE\n");
+}
+
+TEST_F(preprocessor_cache_test, changed_text_reprocessed)
+{
+    auto [p1, doc1] = run("-INC AAA\nBBB\n");
+    const auto stmts1 = p1->take_statements();
+    auto [p2, doc2] = run("-INC AAA\nCCC\n");
+    const auto stmts2 = p2->take_statements();
+
+    ASSERT_EQ(stmts1.size(), 1);
+    ASSERT_EQ(stmts2.size(), 1);
+    EXPECT_NE(stmts1.front(), stmts2.front());
+
+    ASSERT_EQ(doc2.size(), 2);
+    EXPECT_EQ(doc2.at(1).text(), "CCC\n");
+}
+
+TEST_F(preprocessor_cache_test, changed_options_reprocessed)
+{
+    auto [p1, doc1] = run("-INC AAA\nBBB\n");
+    const auto stmts1 = p1->take_statements();
+    auto [p2, doc2] = run("-INC AAA\nBBB\n",
+        {
+            endevor_preprocessor_options(),
+            cics_preprocessor_options(false, false, false),
+        });
+    const auto stmts2 = p2->take_statements();
+
+    ASSERT_FALSE(stmts1.empty());
+    ASSERT_FALSE(stmts2.empty());
+    EXPECT_NE(stmts1.front(), stmts2.front());
+}
+
+TEST_F(preprocessor_cache_test, diagnostics_replayed)
+{
+    run("-INC MISSING\n");
+    EXPECT_TRUE(matches_message_codes(m_diags.diags, { "END001" }));
+
+    m_diags.diags.clear();
+
+    run("-INC MISSING\n");
+    EXPECT_TRUE(matches_message_codes(m_diags.diags, { "END001" }));
+}
+
+TEST(preprocessor_cache, analyzer_results_identical)
+{
+    mock_parse_lib_provider libs({
+        { "MEMBER", R"(
+         LARL 0,DFHVALUE(FIRSTQUIESCE)
+)" },
+    });
+    std::string input = R"(
+TEST    DS     0C
+-INC MEMBER
+        EXEC SQL WHENEVER SQLERROR GO TO ERR
+        LTORG
+TESTLEN EQU    *-TEST
+ERR     DS     0H
+        END
+)";
+    const std::vector<preprocessor_options> pp {
+        endevor_preprocessor_options(),
+        cics_preprocessor_options(false, false, false),
+        db2_preprocessor_options(),
+    };
+    auto cache = std::make_shared<preprocessor_cache>();
+
+    const auto analyze = [&]() {
+        analyzer a(input, analyzer_options { &libs, pp, cache, collect_highlighting_info::yes });
+        a.analyze();
+        return std::pair(a.diags().size(), a.take_semantic_tokens());
+    };
+
+    const auto [diags1, tokens1] = analyze();
+    EXPECT_GT(cache->memory_usage(), 0);
+    const auto [diags2, tokens2] = analyze();
+
+    EXPECT_EQ(diags1, 0);
+    EXPECT_EQ(diags2, 0);
+    EXPECT_EQ(tokens1, tokens2);
+    EXPECT_FALSE(tokens2.empty());
+}
@@ -140,7 +140,7 @@ J        OPSYN MACRO
 
     auto hc = hc_analyzer.take_hit_count_map();
 
-    const auto& details = hc.at(resource_location()).details;
+    const auto details = hc.at(resource_location()).lines();
 
     using processing::line_detail;
     EXPECT_TRUE(std::ranges::equal(
@@ -151,3 +151,45 @@ J        OPSYN MACRO
     EXPECT_TRUE(std::ranges::equal(
         details, std::array { false, false, true, false, false, false, false }, {}, &line_detail::macro_prototype));
 }
+
+TEST(fading, hit_count_runs)
+{
+    using processing::line_detail;
+    const line_detail empty;
+    const line_detail stmt { .count = 1, .contains_statement = true };
+    const line_detail unused { .contains_statement = true };
+
+    const std::vector lines { empty, stmt, stmt, stmt, empty, unused, unused };
+    processing::hit_count_entry e(lines);
+
+    EXPECT_EQ(e.runs().size(), 4);
+    EXPECT_EQ(e.line_count(), lines.size());
+    EXPECT_EQ(e.lines(), lines);
+}
+
+TEST(fading, hit_count_merge)
+{
+    using processing::line_detail;
+    const line_detail empty;
+    const line_detail stmt { .count = 1, .contains_statement = true };
+    const line_detail proto { .macro_prototype = true };
+
+    processing::hit_count_entry a(std::vector { stmt, stmt, stmt });
+    processing::hit_count_entry b(std::vector { empty, stmt, proto, empty, stmt });
+    b.has_sections = true;
+
+    a.merge(b);
+
+    const line_detail twice { .count = 2, .contains_statement = true };
+    const line_detail stmt_proto { .count = 1, .contains_statement = true, .macro_prototype = true };
+
+    EXPECT_TRUE(a.has_sections);
+    EXPECT_EQ(a.lines(), (std::vector { stmt, twice, stmt_proto, empty, stmt }));
+    EXPECT_FALSE(a.contains_prototype(1));
+    EXPECT_TRUE(a.contains_prototype(2));
+    EXPECT_FALSE(a.contains_prototype(10));
+
+    processing::hit_count_entry c;
+    c.merge(a);
+    EXPECT_EQ(c.runs(), a.runs());
+}
@@ -64,6 +64,19 @@ TEST(ebcdic_encoding, unicode)
     EXPECT_EQ(begin, std::to_address(u8.end()));
 }
 
+TEST(ebcdic_encoding, string_round_trip)
+{
+    const std::string text = "SOME LONG ASCII PREFIX \xC3\xA4" "ABC" "\xEE\x80\x8D" "abcdefghijklmnopqrstuvwxyz";
+
+    const auto ebcdic = ebcdic_encoding::to_ebcdic(text);
+
+    ASSERT_EQ(ebcdic.size(), 54);
+    EXPECT_EQ(ebcdic[0], (char)0xE2);
+    EXPECT_EQ(ebcdic[23], (char)0x43);
+    EXPECT_EQ(ebcdic[27], (char)0x0D);
+    EXPECT_EQ(ebcdic_encoding::to_ascii(ebcdic), text);
+}
+
 TEST(encoding, server_substitution)
 {
     std::string input = "&VAR SETC 'PARAM\xA2'"; // 'PARAM¢' in ISO/IEC 8859-1
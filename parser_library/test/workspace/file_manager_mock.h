@@ -30,6 +30,10 @@ public:
         add_file,
         (const resource_location&),
         (override));
+    MOCK_METHOD(value_task<std::vector<std::shared_ptr<hlasm_plugin::parser_library::workspaces::file>>>,
+        add_files,
+        (std::vector<resource_location>),
+        (override));
     MOCK_METHOD(std::shared_ptr<hlasm_plugin::parser_library::workspaces::file>,
         find,
         (const resource_location& key),
@@ -42,6 +46,7 @@ public:
         list_directory_subdirs_and_symlinks,
         (const resource_location& path),
         (const, override));
+    MOCK_METHOD(std::optional<bool>, is_regular_file, (const resource_location& res_loc), (const, override));
     MOCK_METHOD(std::string, canonical, (const resource_location& res_loc, std::error_code& ec), (const, override));
     MOCK_METHOD(hlasm_plugin::parser_library::workspaces::file_content_state,
         did_open_file,
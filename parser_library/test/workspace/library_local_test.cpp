@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "../common_testing.h"
+#include "utils/platform.h"
+#include "workspace_manager.h"
+#include "workspaces/file_manager_impl.h"
+#include "workspaces/library_local.h"
+
+using namespace hlasm_plugin::parser_library;
+using namespace hlasm_plugin::parser_library::workspaces;
+using namespace hlasm_plugin::utils::resource;
+
+namespace {
+const resource_location lib_loc("test://workspace/lib/");
+
+class file_manager_listing_mock : public file_manager_impl
+{
+public:
+    mutable size_t list_count = 0;
+    std::vector<std::pair<std::string, resource_location>> files;
+    std::vector<resource_location> directories;
+    bool types_known = true;
+    bool suspend_listing = false;
+
+    hlasm_plugin::utils::value_task<list_directory_result> list_directory_files(const resource_location&) const override
+    {
+        ++list_count;
+        using hlasm_plugin::utils::value_task;
+        return [](list_directory_result result, bool suspend) -> value_task<list_directory_result> {
+            if (suspend)
+                co_await hlasm_plugin::utils::task::suspend();
+            co_return result;
+        }({ files, hlasm_plugin::utils::path::list_directory_rc::done }, suspend_listing);
+    }
+
+    std::optional<bool> is_regular_file(const resource_location& res_loc) const override
+    {
+        if (!types_known)
+            return std::nullopt;
+        return std::ranges::find(directories, res_loc) == directories.end();
+    }
+};
+
+struct library_local_test : public ::testing::Test
+{
+    file_manager_listing_mock file_mngr;
+    library_local lib { file_mngr, lib_loc, { { ".hlasm" } }, resource_location() };
+
+    void SetUp() override
+    {
+        file_mngr.files = {
+            { "MAC1.hlasm", resource_location::join(lib_loc, "MAC1.hlasm") },
+            { "MAC2.hlasm", resource_location::join(lib_loc, "MAC2.hlasm") },
+        };
+        run_if_valid(lib.prefetch());
+    }
+
+    std::vector<std::string> files()
+    {
+        auto result = lib.list_files();
+        std::ranges::sort(result);
+        return result;
+    }
+};
+} // namespace
+
+TEST_F(library_local_test, created_file)
+{
+    const resource_location file = resource_location::join(lib_loc, "MAC3.hlasm");
+    const fs_change_type change = fs_change_type::created;
+
+    EXPECT_TRUE(lib.update_files({ &file, 1 }, { &change, 1 }));
+
+    EXPECT_EQ(files(), (std::vector<std::string> { "MAC1", "MAC2", "MAC3" }));
+    resource_location url;
+    EXPECT_TRUE(lib.has_file("MAC3", &url));
+    EXPECT_EQ(url, file);
+    EXPECT_EQ(file_mngr.list_count, 1);
+}
+
+TEST_F(library_local_test, deleted_file)
+{
+    const resource_location file = resource_location::join(lib_loc, "MAC1.hlasm");
+    const fs_change_type change = fs_change_type::deleted;
+
+    EXPECT_TRUE(lib.update_files({ &file, 1 }, { &change, 1 }));
+
+    EXPECT_EQ(files(), (std::vector<std::string> { "MAC2" }));
+    EXPECT_EQ(file_mngr.list_count, 1);
+}
+
+TEST_F(library_local_test, renamed_file)
+{
+    const resource_location changed_files[] = {
+        resource_location::join(lib_loc, "MAC1.hlasm"),
+        resource_location::join(lib_loc, "MAC4.hlasm"),
+        resource_location::join(lib_loc, "MAC2.hlasm"),
+    };
+    const fs_change_type changes[] = {
+        fs_change_type::deleted,
+        fs_change_type::created,
+        fs_change_type::changed,
+    };
+
+    EXPECT_TRUE(lib.update_files(changed_files, changes));
+
+    EXPECT_EQ(files(), (std::vector<std::string> { "MAC2", "MAC4" }));
+    EXPECT_EQ(file_mngr.list_count, 1);
+}
+
+TEST_F(library_local_test, conflicts)
+{
+    const resource_location file = resource_location::join(lib_loc, "MAC1.asm.hlasm");
+    const fs_change_type created = fs_change_type::created;
+    const fs_change_type deleted = fs_change_type::deleted;
+
+    EXPECT_TRUE(lib.update_files({ &file, 1 }, { &created, 1 }));
+    resource_location url;
+    EXPECT_TRUE(lib.has_file("MAC1.ASM", &url));
+
+    const resource_location conflict = resource_location::join(lib_loc, "mac1.hlasm");
+    EXPECT_TRUE(lib.update_files({ &conflict, 1 }, { &created, 1 }));
+
+    std::vector<diagnostic> diags;
+    lib.copy_diagnostics(diags);
+    EXPECT_TRUE(matches_message_codes(diags, { "L0004" }));
+    EXPECT_TRUE(lib.has_file("MAC1", &url));
+    EXPECT_EQ(url, resource_location::join(lib_loc, "MAC1.hlasm"));
+
+    const resource_location original = resource_location::join(lib_loc, "MAC1.hlasm");
+    EXPECT_TRUE(lib.update_files({ &original, 1 }, { &deleted, 1 }));
+
+    diags.clear();
+    lib.copy_diagnostics(diags);
+    EXPECT_TRUE(diags.empty());
+    EXPECT_TRUE(lib.has_file("MAC1", &url));
+    EXPECT_EQ(url, conflict);
+    EXPECT_EQ(file_mngr.list_count, 1);
+}
+
+TEST_F(library_local_test, unrelated_files)
+{
+    const resource_location changed_files[] = {
+        resource_location("test://workspace/other/MAC5.hlasm"),
+        resource_location::join(lib_loc, "sub/MAC6.hlasm"),
+    };
+    const fs_change_type changes[] = {
+        fs_change_type::created,
+        fs_change_type::created,
+    };
+
+    EXPECT_TRUE(lib.update_files(changed_files, changes));
+
+    EXPECT_EQ(files(), (std::vector<std::string> { "MAC1", "MAC2" }));
+}
+
+TEST_F(library_local_test, directory_change_needs_refresh)
+{
+    const resource_location changed_files[] = {
+        lib_loc,
+        resource_location("test://workspace/"),
+    };
+    const fs_change_type change = fs_change_type::deleted;
+
+    EXPECT_FALSE(lib.update_files({ &changed_files[0], 1 }, { &change, 1 }));
+    EXPECT_FALSE(lib.update_files({ &changed_files[1], 1 }, { &change, 1 }));
+}
+
+TEST_F(library_local_test, unknown_change_needs_refresh)
+{
+    const resource_location file = resource_location::join(lib_loc, "MAC3.hlasm");
+    const fs_change_type change = fs_change_type::invalid;
+
+    EXPECT_FALSE(lib.update_files({ &file, 1 }, { &change, 1 }));
+    EXPECT_FALSE(lib.update_files({ &file, 1 }, {}));
+}
+
+TEST_F(library_local_test, created_directory)
+{
+    const resource_location dir = resource_location::join(lib_loc, "MAC3.hlasm");
+    file_mngr.directories.push_back(dir);
+    const fs_change_type change = fs_change_type::created;
+
+    EXPECT_TRUE(lib.update_files({ &dir, 1 }, { &change, 1 }));
+
+    EXPECT_EQ(files(), (std::vector<std::string> { "MAC1", "MAC2" }));
+    EXPECT_EQ(file_mngr.list_count, 1);
+}
+
+TEST_F(library_local_test, created_unknown_type_needs_refresh)
+{
+    const resource_location file = resource_location::join(lib_loc, "MAC3.hlasm");
+    file_mngr.types_known = false;
+    const fs_change_type change = fs_change_type::created;
+
+    EXPECT_FALSE(lib.update_files({ &file, 1 }, { &change, 1 }));
+}
+
+TEST_F(library_local_test, change_during_refresh)
+{
+    file_mngr.suspend_listing = true;
+    auto refresh = lib.refresh();
+    refresh.resume(nullptr);
+    ASSERT_FALSE(refresh.done());
+
+    const resource_location file = resource_location::join(lib_loc, "MAC3.hlasm");
+    file_mngr.files.emplace_back("MAC3.hlasm", file);
+    const fs_change_type change = fs_change_type::created;
+    EXPECT_TRUE(lib.update_files({ &file, 1 }, { &change, 1 }));
+
+    // the listing in flight was taken before the change
+    file_mngr.suspend_listing = false;
+    refresh.run();
+
+    EXPECT_EQ(files(), (std::vector<std::string> { "MAC1", "MAC2", "MAC3" }));
+    EXPECT_EQ(file_mngr.list_count, 3);
+}
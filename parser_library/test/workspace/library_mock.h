@@ -16,7 +16,9 @@
 #include "gtest/gtest.h"
 
 #include "diagnostic.h"
+#include "utils/resource_location.h"
 #include "utils/task.h"
+#include "workspace_manager.h"
 #include "workspaces/library.h"
 
 namespace {
@@ -26,10 +28,16 @@ public:
     // Inherited via library
     MOCK_METHOD(hlasm_plugin::utils::task, refresh, (), (override));
     MOCK_METHOD(hlasm_plugin::utils::task, prefetch, (), (override));
+    MOCK_METHOD(bool,
+        update_files,
+        (std::span<const hlasm_plugin::utils::resource::resource_location>,
+            std::span<const hlasm_plugin::parser_library::fs_change_type>),
+        (override));
     MOCK_METHOD(std::vector<std::string>, list_files, (), (override));
     MOCK_METHOD(const hlasm_plugin::utils::resource::resource_location&, get_location, (), (const, override));
     MOCK_METHOD(bool, has_file, (std::string_view, hlasm_plugin::utils::resource::resource_location* url), (override));
     MOCK_METHOD(void, copy_diagnostics, (std::vector<hlasm_plugin::parser_library::diagnostic>&), (const, override));
     MOCK_METHOD(bool, has_cached_content, (), (const, override));
+    MOCK_METHOD(std::size_t, memory_usage, (), (const, override));
 };
 } // namespace
@@ -346,7 +346,7 @@ TEST(macro_cache_test, overwrite_by_inline)
     using namespace ::testing;
     auto library = std::make_shared<NiceMock<library_mock>>();
 
-    EXPECT_CALL(*library, get_location).WillOnce(ReturnRef(lib_loc));
+    EXPECT_CALL(*library, get_location).WillRepeatedly(ReturnRef(lib_loc));
 
     workspace_configuration ws_cfg(file_mngr, global_settings, config, library);
     workspace ws(file_mngr, ws_cfg);
@@ -49,7 +49,7 @@ TEST(processor_file, parse_macro)
     resource_location lib_loc("");
     auto library = std::make_shared<NiceMock<library_mock>>();
 
-    EXPECT_CALL(*library, get_location).WillOnce(ReturnRef(lib_loc));
+    EXPECT_CALL(*library, get_location).WillRepeatedly(ReturnRef(lib_loc));
 
     workspace_configuration ws_cfg(mngr, global_settings, config, library);
     workspace ws(mngr, ws_cfg);
@@ -88,6 +88,10 @@ TEST(processor_file, parse_macro)
     expected_metrics.macro_statements = 2;
     expected_metrics.non_continued_statements = 6;
     expected_metrics.open_code_statements = 2;
+    expected_metrics.open_code_opcode_cache_hits = 1;
+    expected_metrics.open_code_opcode_cache_misses = 2;
+    expected_metrics.macro_opcode_cache_hits = 1;
+    expected_metrics.macro_opcode_cache_misses = 4;
     EXPECT_EQ(metrics, expected_metrics);
     EXPECT_EQ(ws.last_metrics(opencode_loc), expected_metrics);
     EXPECT_EQ(wf_info.files_processed, 2);
@@ -1153,6 +1153,7 @@ public:
         parse_all_files(ws);
     }
 
+    void set_memory_budget(std::size_t bytes) { ws.set_memory_budget(bytes); }
 
 private:
     const static inline std::string source_template = R"(
@@ -1244,6 +1245,31 @@ TEST(fade, cpybook_as_pgm)
     EXPECT_EQ(fh.fade_messages().size(), static_cast<size_t>(0));
 }
 
+TEST(fade, retained_with_memory_budget)
+{
+    static const resource_location srcA_loc("fade:/A.hlasm");
+    static const resource_location srcB_loc("fade:/B.hlasm");
+    static const resource_location srcC_loc("fade:/C.hlasm");
+
+    fade_helper fh(std::vector<fade_helper::files_details>({
+        fade_helper::files_details { srcA_loc, false, workspaces::file_content_state::changed_content },
+        fade_helper::files_details { srcB_loc, false, workspaces::file_content_state::changed_content },
+        fade_helper::files_details { srcC_loc, true, workspaces::file_content_state::changed_lsp },
+    }));
+
+    // reopening A drops the analysis results of the other programs
+    fh.set_memory_budget(1);
+    fh.did_close_file(srcA_loc);
+    fh.did_open_file(srcA_loc);
+
+    EXPECT_TRUE(matches_fade_messages(fh.fade_messages(),
+        std::vector<fade_message>({
+            fade_message::inactive_statement("fade:/C.hlasm", range(position(3, 0), position(3, 80))),
+            fade_message::inactive_statement("fade:/C.hlasm", range(position(8, 0), position(8, 80))),
+            fade_message::inactive_statement("fade:/C.hlasm", range(position(15, 0), position(15, 80))),
+        })));
+}
+
 TEST(fade, preprocessor)
 {
     auto ws_mngr = create_workspace_manager();
@@ -13,6 +13,7 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 
 #include "gtest/gtest.h"
@@ -21,6 +22,7 @@
 #include "empty_configs.h"
 #include "external_configuration_requests_mock.h"
 #include "external_file_reader_mock.h"
+#include "memory_stats.h"
 #include "utils/platform.h"
 #include "utils/resource_location.h"
 #include "workspaces/file_manager.h"
@@ -731,3 +733,221 @@ TEST_F(workspace_test, track_nested_dependencies)
     parse_all_files(ws);
     EXPECT_TRUE(matches_message_codes(extract_diags(ws, ws_cfg), { "MNOTE" }));
 }
+
+TEST_F(workspace_test, macro_shared_between_programs)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+
+    run_if_valid(ws.did_open_file(source2_loc));
+    parse_all_files(ws);
+
+    const auto m1 = ws.last_metrics(source1_loc);
+    const auto m2 = ws.last_metrics(source2_loc);
+    ASSERT_TRUE(m1 && m2);
+
+    EXPECT_GT(m1->macro_def_statements, 0);
+    // the macro parsed for the first program is reused
+    EXPECT_EQ(m2->macro_def_statements, 0);
+    EXPECT_EQ(m1->macro_statements, m2->macro_statements);
+}
+
+TEST_F(workspace_test, macro_not_shared_between_groups)
+{
+    NiceMock<external_file_reader_mock> external_files;
+    file_manager_impl fm(external_files, nullptr);
+
+    fm.did_open_file(pgm_conf_loc, 1, R"({
+  "pgms": [
+    { "program": "source1", "pgroup": "P1" },
+    { "program": "source2", "pgroup": "P2" }
+  ]
+})");
+    fm.did_open_file(proc_grps_loc, 1, R"({
+  "pgroups": [
+    { "name": "P1", "libs": [ "shared", "lib1" ] },
+    { "name": "P2", "libs": [ "shared", "lib2" ] }
+  ]
+})");
+    const resource_location mac_loc("ws:/shared/MAC");
+    const resource_location member1_loc("ws:/lib1/MEMBER");
+    const resource_location member2_loc("ws:/lib2/MEMBER");
+    fm.did_open_file(source1_loc, 1, " MAC");
+    fm.did_open_file(source2_loc, 1, " MAC");
+    fm.did_open_file(mac_loc, 1, " MACRO\n MAC\n COPY MEMBER\n MEND");
+    fm.did_open_file(member1_loc, 1, " MNOTE 'ONE'");
+    fm.did_open_file(member2_loc, 1, " MNOTE 'TWO'");
+
+    ON_CALL(external_files, list_directory_files(_)).WillByDefault(Invoke([&](const resource_location& dir) {
+        list_directory_result result { {}, path::list_directory_rc::done };
+        if (dir == resource_location("ws:/shared/"))
+            result.first.emplace_back("MAC", mac_loc);
+        else if (dir == resource_location("ws:/lib1/"))
+            result.first.emplace_back("MEMBER", member1_loc);
+        else if (dir == resource_location("ws:/lib2/"))
+            result.first.emplace_back("MEMBER", member2_loc);
+        return value_task<list_directory_result>::from_value(std::move(result));
+    }));
+
+    config.diag_supress_limit = 0;
+    workspace_configuration ws_cfg(fm, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(fm, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    run_if_valid(ws.did_open_file(source2_loc));
+    parse_all_files(ws);
+
+    // the copy member used by the macro is resolved through the libraries of each group
+    EXPECT_TRUE(matches_message_text(extract_diags(ws, ws_cfg), { "ONE", "TWO" }));
+}
+
+TEST_F(workspace_test, identifiers_released_with_programs)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+
+    memory_stats opened;
+    ws.collect_memory_stats(opened);
+    EXPECT_GT(opened.id_storage, 0);
+
+    run_if_valid(ws.did_close_file(source1_loc));
+
+    memory_stats closed;
+    ws.collect_memory_stats(closed);
+    EXPECT_EQ(closed.id_storage, 0);
+
+    // identifiers are created afresh for the next program
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+
+    memory_stats reopened;
+    ws.collect_memory_stats(reopened);
+    EXPECT_GT(reopened.id_storage, 0);
+    EXPECT_TRUE(match_file_uri(extract_diags(ws, ws_cfg), { faulty_macro_loc, source1_loc }));
+}
+
+TEST_F(workspace_test, dependants_reparsed_for_diagnostics)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+
+    const auto tokens = ws.semantic_tokens(source1_loc);
+    EXPECT_FALSE(tokens.empty());
+    const auto references = ws.references(source1_loc, position(0, 2));
+    EXPECT_FALSE(references.empty());
+
+    run_if_valid(ws.mark_file_for_parsing(faulty_macro_loc, file_content_state::changed_content));
+    parse_all_files(ws);
+
+    // previous semantic tokens are kept until the full analysis is requested
+    EXPECT_EQ(ws.semantic_tokens(source1_loc), tokens);
+    // occurrences are not collected
+    EXPECT_TRUE(ws.references(source1_loc, position(0, 2)).empty());
+
+    ws.request_full_analysis(source1_loc);
+    auto full = ws.parse_file();
+    ASSERT_TRUE(full.valid());
+    full.run();
+    EXPECT_EQ(ws.semantic_tokens(source1_loc), tokens);
+    EXPECT_EQ(ws.references(source1_loc, position(0, 2)), references);
+
+    ws.request_full_analysis(source1_loc);
+    EXPECT_FALSE(ws.parse_file().valid());
+}
+
+TEST_F(workspace_test, full_analysis_requested_during_reduced_parse)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+
+    run_if_valid(ws.mark_file_for_parsing(faulty_macro_loc, file_content_state::changed_content));
+
+    const std::atomic<unsigned char> yield_indicator = 1;
+    auto reduced = ws.parse_file();
+    ASSERT_TRUE(reduced.valid());
+    reduced.resume(&yield_indicator);
+    ASSERT_FALSE(reduced.done());
+
+    ws.request_full_analysis(source1_loc);
+    reduced.run();
+
+    // the request is not lost when the reduced analysis completes
+    auto full = ws.parse_file();
+    ASSERT_TRUE(full.valid());
+    full.run();
+
+    EXPECT_FALSE(ws.parse_file().valid());
+}
+
+TEST_F(workspace_test, full_analysis_requested_from_dependency)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    run_if_valid(ws.did_open_file(source2_loc));
+    parse_all_files(ws);
+
+    run_if_valid(ws.mark_file_for_parsing(faulty_macro_loc, file_content_state::changed_content));
+    parse_all_files(ws);
+
+    // queries in the macro are answered by one of the programs using it, only that one is upgraded
+    ws.request_full_analysis(faulty_macro_loc);
+    auto full = ws.parse_file();
+    ASSERT_TRUE(full.valid());
+    full.run();
+
+    EXPECT_FALSE(ws.parse_file().valid());
+}
+
+TEST_F(workspace_test, memory_budget_evicts_least_recently_used)
+{
+    file_manager_extended file_manager;
+    workspace_configuration ws_cfg(file_manager, ws_loc, global_settings, config, nullptr, nullptr);
+    workspace ws(file_manager, ws_cfg);
+    ws_cfg.parse_configuration_file().run();
+    ws.set_memory_budget(1);
+
+    run_if_valid(ws.did_open_file(source1_loc));
+    parse_all_files(ws);
+
+    const auto tokens = ws.semantic_tokens(source1_loc);
+    EXPECT_FALSE(tokens.empty());
+
+    run_if_valid(ws.did_open_file(source2_loc));
+    parse_all_files(ws);
+
+    EXPECT_TRUE(ws.semantic_tokens(source1_loc).empty());
+    EXPECT_FALSE(ws.semantic_tokens(source2_loc).empty());
+    // diagnostics are kept for all programs
+    EXPECT_TRUE(match_file_uri(extract_diags(ws, ws_cfg), { faulty_macro_loc, source2_loc, source1_loc }));
+
+    ws.request_full_analysis(source1_loc);
+    parse_all_files(ws);
+
+    EXPECT_EQ(ws.semantic_tokens(source1_loc), tokens);
+    EXPECT_TRUE(ws.semantic_tokens(source2_loc).empty());
+}
@@ -12,12 +12,22 @@
  *   Broadcom, Inc. - initial API and implementation
  */
 
+#include <atomic>
+#include <chrono>
+#include <format>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
 #include "common_testing.h"
 #include "debugging/debugger_configuration.h"
 #include "lib_config.h"
+#include "memory_stats.h"
 #include "message_consumer_mock.h"
 #include "nlohmann/json.hpp"
 #include "utils/platform.h"
@@ -210,3 +220,190 @@ TEST(workspace_manager, implicit_configuration_base_changed)
 
     EXPECT_TRUE(matches_message_text(diags.diags, { "Hello" }));
 }
+
+TEST(workspace_manager, memory_stats)
+{
+    auto ws_mngr = create_workspace_manager();
+
+    ws_mngr->add_workspace("workspace", "test/library/test_wks");
+    ws_mngr->did_open_file("test/library/test_wks/some_file", 1, "label lr 1,2");
+    ws_mngr->idle_handler();
+
+    auto [resp, mock] =
+        make_workspace_manager_response(std::in_place_type<workspace_manager_response_mock<const memory_stats&>>);
+
+    EXPECT_CALL(*mock, provide(Truly([](const memory_stats& stats) {
+        return stats.id_storage > 0 && stats.file_texts > 0 && stats.workspaces.size() == 2 && stats.files.size() == 1
+            && stats.files.front().uri.ends_with("some_file") && stats.files.front().lsp_context > 0
+            && stats.files.front().semantic_tokens > 0;
+    })));
+
+    ws_mngr->memory_stats(resp);
+}
+
+namespace {
+// Stands in for the client, serves the members of a single library after a delay
+class delayed_external_files final : public workspace_manager_external_file_requests
+{
+    std::string m_dir;
+    std::map<std::string, std::string, std::less<>> m_members;
+    std::chrono::milliseconds m_latency;
+
+    std::mutex m_mutex;
+    std::vector<std::jthread> m_responders;
+    std::atomic<int> m_unanswered = 0;
+
+    void respond(std::vector<std::pair<std::string, workspace_manager_response<std::string_view>>> requests)
+    {
+        std::lock_guard g(m_mutex);
+        ++m_unanswered;
+        m_responders.emplace_back([this, requests = std::move(requests)]() {
+            std::this_thread::sleep_for(m_latency);
+            for (const auto& [url, content] : requests)
+            {
+                if (auto it = m_members.find(url); it != m_members.end())
+                    content.provide(it->second);
+                else
+                    content.error(0, "Not found");
+            }
+            --m_unanswered;
+        });
+    }
+
+public:
+    std::atomic<int> single_requests = 0;
+    std::atomic<int> bulk_requests = 0;
+
+    delayed_external_files(std::string dir, std::map<std::string, std::string, std::less<>> members)
+        : m_dir(std::move(dir))
+        , m_latency(2)
+    {
+        for (auto& [name, text] : members)
+            m_members.try_emplace(m_dir + name, std::move(text));
+    }
+
+    bool waiting() const { return m_unanswered > 0; }
+    int requests() const { return single_requests + bulk_requests; }
+
+    void read_external_file(std::string_view url, workspace_manager_response<std::string_view> content) override
+    {
+        if (!url.starts_with(m_dir))
+        {
+            content.error(0, "Not found");
+            return;
+        }
+        ++single_requests;
+        respond({ { std::string(url), std::move(content) } });
+    }
+
+    void read_external_files(std::span<const workspace_manager_external_file_request> requests) override
+    {
+        ++bulk_requests;
+        std::vector<std::pair<std::string, workspace_manager_response<std::string_view>>> copy;
+        for (const auto& r : requests)
+            copy.emplace_back(std::string(r.url), r.content);
+        respond(std::move(copy));
+    }
+
+    void read_external_directory(std::string_view url,
+        workspace_manager_response<workspace_manager_external_directory_result> members,
+        bool) override
+    {
+        if (url != m_dir)
+        {
+            members.error(0, "Not found");
+            return;
+        }
+        std::vector<std::string_view> urls;
+        for (const auto& [member_url, _] : m_members)
+            urls.push_back(member_url);
+        members.provide(workspace_manager_external_directory_result { .member_urls = urls });
+    }
+};
+} // namespace
+
+TEST(workspace_manager, remote_members_fetched_in_bulk)
+{
+    constexpr size_t macro_count = 20;
+
+    std::map<std::string, std::string, std::less<>> members;
+    std::string program;
+    for (size_t i = 0; i < macro_count; ++i)
+    {
+        members.try_emplace(std::format("MAC{}", i), std::format(" MACRO\n MAC{}\n INNER{}\n MEND\n", i, i));
+        members.try_emplace(
+            std::format("INNER{}", i), std::format(" MACRO\n INNER{}\n MNOTE 'Hello {}'\n MEND\n", i, i));
+        program.append(std::format(" MAC{}\n", i));
+    }
+
+    delayed_external_files client("test:/dir/macs/", std::move(members));
+    diag_consumer_mock diags;
+
+    auto ws_mngr = create_workspace_manager({ .external_requests = &client, .vscode_extensions = true });
+    ws_mngr->register_diagnostics_consumer(&diags);
+    ws_mngr->add_workspace("dir", "test:/dir");
+    ws_mngr->configuration_changed({},
+        R"({"hlasm":{"proc_grps":{"pgroups":[{"name":"P1","libs":["test:/dir/macs/"]}]},"pgm_conf":{"pgms":[{"program":"**","pgroup":"P1"}]}}})");
+
+    ws_mngr->did_open_file("untitled:PGM", 1, program);
+
+    // the analysis is suspended while the responses are in flight
+    for (bool pending = true; pending;)
+    {
+        const auto requests = client.requests();
+        pending = client.waiting();
+        ws_mngr->idle_handler();
+        pending |= client.requests() != requests;
+    }
+
+    EXPECT_EQ(diags.diags.size(), macro_count);
+    EXPECT_TRUE(std::ranges::all_of(diags.diags, [](const auto& d) { return d.message.starts_with("Hello "); }));
+
+    // one round for the macros called by the program and one for the macros they call
+    EXPECT_EQ(client.bulk_requests, 2);
+    EXPECT_EQ(client.single_requests, 0);
+}
+
+TEST(workspace_manager, unused_predictions_not_fetched_again)
+{
+    delayed_external_files client("test:/dir/macs/",
+        {
+            { "USED", " MACRO\n USED\n MNOTE 'Used'\n MEND\n" },
+            { "UNUSED", " MACRO\n UNUSED\n MNOTE 'Unused'\n MEND\n" },
+        });
+    diag_consumer_mock diags;
+
+    auto ws_mngr = create_workspace_manager({ .external_requests = &client, .vscode_extensions = true });
+    ws_mngr->register_diagnostics_consumer(&diags);
+    ws_mngr->add_workspace("dir", "test:/dir");
+    ws_mngr->configuration_changed({},
+        R"({"hlasm":{"proc_grps":{"pgroups":[{"name":"P1","libs":["test:/dir/macs/"]}]},"pgm_conf":{"pgms":[{"program":"**","pgroup":"P1"}]}}})");
+
+    const auto settle = [&]() {
+        for (bool pending = true; pending;)
+        {
+            const auto requests = client.requests();
+            pending = client.waiting();
+            ws_mngr->idle_handler();
+            pending |= client.requests() != requests;
+        }
+    };
+
+    ws_mngr->did_open_file("untitled:PGM", 1, " USED\n AGO .SKIP\n UNUSED\n.SKIP ANOP\n");
+    settle();
+
+    ASSERT_EQ(diags.diags.size(), 1);
+    EXPECT_EQ(diags.diags[0].message, "Used");
+    const auto requests = client.requests();
+    EXPECT_GT(requests, 0);
+
+    for (int version = 2; version < 5; ++version)
+    {
+        const document_change change({ { 3, 10 }, { 3, 10 } }, " ");
+        ws_mngr->did_change_file("untitled:PGM", version, std::span(&change, 1));
+        settle();
+    }
+
+    ASSERT_EQ(diags.diags.size(), 1);
+    EXPECT_EQ(client.requests(), requests);
+}
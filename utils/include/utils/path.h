@@ -37,6 +37,7 @@ std::filesystem::path canonical(const std::filesystem::path& p);
 std::filesystem::path canonical(const std::filesystem::path& p, std::error_code& ec);
 bool equal(const std::filesystem::path& left, const std::filesystem::path& right);
 bool is_directory(const std::filesystem::path& p);
+bool is_regular_file(const std::filesystem::path& p);
 
 list_directory_rc list_directory_regular_files(
     const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#ifndef HLASMPLUGIN_UTILS_POOLED_ALLOCATOR_H
+#define HLASMPLUGIN_UTILS_POOLED_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace hlasm_plugin::utils {
+
+// Single-threaded pool for short-lived objects. Allocations made through pooled_allocator keep the pool alive,
+// so the objects may safely outlive the component that created them.
+class object_pool
+{
+    std::shared_ptr<std::pmr::unsynchronized_pool_resource> m_resource =
+        std::make_shared<std::pmr::unsynchronized_pool_resource>();
+
+    template<typename T>
+    friend class pooled_allocator;
+
+public:
+    template<typename T, typename... Args>
+    std::shared_ptr<T> make_shared(Args&&... args) const;
+};
+
+template<typename T>
+class pooled_allocator
+{
+    std::shared_ptr<std::pmr::unsynchronized_pool_resource> m_resource;
+
+    template<typename U>
+    friend class pooled_allocator;
+
+public:
+    using value_type = T;
+
+    explicit pooled_allocator(const object_pool& pool) noexcept
+        : m_resource(pool.m_resource)
+    {}
+
+    template<typename U>
+    pooled_allocator(const pooled_allocator<U>& other) noexcept
+        : m_resource(other.m_resource)
+    {}
+
+    [[nodiscard]] T* allocate(std::size_t n)
+    {
+        return static_cast<T*>(m_resource->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept { m_resource->deallocate(p, n * sizeof(T), alignof(T)); }
+
+    template<typename U>
+    bool operator==(const pooled_allocator<U>& other) const noexcept
+    {
+        return m_resource == other.m_resource;
+    }
+};
+
+template<typename T, typename... Args>
+std::shared_ptr<T> object_pool::make_shared(Args&&... args) const
+{
+    return std::allocate_shared<T>(pooled_allocator<T>(*this), std::forward<Args>(args)...);
+}
+
+} // namespace hlasm_plugin::utils
+
+#endif
@@ -65,6 +65,15 @@ struct timestamp
     static std::optional<timestamp> now();
 };
 
+// Provides the time observed by an analysis, the current time is used when none is provided
+class time_source
+{
+public:
+    virtual timestamp now() = 0;
+
+protected:
+    ~time_source() = default;
+};
 
 } // namespace hlasm_plugin::utils
 
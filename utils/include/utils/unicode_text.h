@@ -71,6 +71,9 @@ character_replaced append_utf8_sanitized(std::string& result, std::string_view s
 
 bool utf8_one_byte_begin(char ch);
 
+// returns the length of the leading run of 7-bit characters, the text is scanned a machine word at a time
+size_t ascii_prefix_length(std::string_view text) noexcept;
+
 std::string replace_non_utf8_chars(std::string_view text);
 
 // skip <count> UTF-8 characters
@@ -380,6 +380,27 @@ public:
 
         return result == 1;
     }
+
+    bool is_file(const std::filesystem::path& path)
+    {
+        int result = EM_ASM_INT(
+            {
+                try
+                {
+                    if (require('fs').statSync(UTF8ToString($0)).isFile())
+                        return 1;
+                    else
+                        return 0;
+                }
+                catch (e)
+                {
+                    return -1;
+                }
+            },
+            (intptr_t)path.c_str());
+
+        return result == 1;
+    }
 };
 
 std::filesystem::path current_path()
@@ -429,4 +450,6 @@ std::filesystem::path canonical(const std::filesystem::path& p, std::error_code&
 
 bool is_directory(const std::filesystem::path& p) { return directory_op_support().is_dir(p); }
 
+bool is_regular_file(const std::filesystem::path& p) { return directory_op_support().is_file(p); }
+
 } // namespace hlasm_plugin::utils::path
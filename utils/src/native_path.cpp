@@ -52,6 +52,13 @@ bool is_directory(const std::filesystem::path& p)
 
     return !ec && d.is_directory();
 }
+bool is_regular_file(const std::filesystem::path& p)
+{
+    std::error_code ec;
+    std::filesystem::directory_entry d(p, ec);
+
+    return !ec && d.is_regular_file();
+}
 
 list_directory_rc list_directory_regular_files(
     const std::filesystem::path& d, std::function<void(const std::filesystem::path&)> h)
@@ -16,6 +16,8 @@
 
 #include <algorithm>
 #include <bit>
+#include <cstdint>
+#include <cstring>
 
 namespace hlasm_plugin::utils {
 constinit const std::array<char_size, 256> utf8_prefix_sizes = []() {
@@ -132,16 +134,36 @@ bool utf8_four_byte_begin(char ch)
     return (ch & 0xF8) == 0xF0; // 11110xxx
 }
 
+size_t ascii_prefix_length(std::string_view text) noexcept
+{
+    constexpr uint64_t high_bits = 0x8080808080808080ULL;
+
+    size_t result = 0;
+    while (text.size() - result >= sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, text.data() + result, sizeof(word));
+        if (word & high_bits)
+            break;
+        result += sizeof(word);
+    }
+
+    while (result < text.size() && utf8_one_byte_begin(text[result]))
+        ++result;
+
+    return result;
+}
+
 std::string replace_non_utf8_chars(std::string_view text)
 {
     std::string ret;
     ret.reserve(text.size());
     while (!text.empty())
     {
-        if (utf8_one_byte_begin(text.front()))
+        if (const auto ascii = ascii_prefix_length(text))
         {
-            ret.push_back(text.front());
-            text.remove_prefix(1);
+            ret.append(text.substr(0, ascii));
+            text.remove_prefix(ascii);
             continue;
         }
 
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Broadcom.
+ * The term "Broadcom" refers to Broadcom Inc. and/or its subsidiaries.
+ *
+ * This program and the accompanying materials are made
+ * available under the terms of the Eclipse Public License 2.0
+ * which is available at https://www.eclipse.org/legal/epl-2.0/
+ *
+ * SPDX-License-Identifier: EPL-2.0
+ *
+ * Contributors:
+ *   Broadcom, Inc. - initial API and implementation
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/pooled_allocator.h"
+
+using namespace hlasm_plugin::utils;
+
+TEST(pooled_allocator, make_shared)
+{
+    object_pool pool;
+
+    auto p = pool.make_shared<std::string>(100, 'A');
+
+    EXPECT_EQ(*p, std::string(100, 'A'));
+}
+
+TEST(pooled_allocator, outlives_pool)
+{
+    std::shared_ptr<std::vector<int>> p;
+    {
+        object_pool pool;
+        p = pool.make_shared<std::vector<int>>(std::vector<int> { 1, 2, 3 });
+    }
+
+    EXPECT_EQ(*p, (std::vector<int> { 1, 2, 3 }));
+}
+
+TEST(pooled_allocator, equality)
+{
+    object_pool pool1;
+    object_pool pool2;
+
+    EXPECT_EQ(pooled_allocator<int>(pool1), pooled_allocator<char>(pool1));
+    EXPECT_NE(pooled_allocator<int>(pool1), pooled_allocator<int>(pool2));
+}
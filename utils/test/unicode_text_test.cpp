@@ -164,6 +164,24 @@ TEST(utf8, iterator)
     EXPECT_EQ(it.counter<2>(), 0);
 }
 
+TEST(utf8, ascii_prefix_length)
+{
+    using hlasm_plugin::utils::ascii_prefix_length;
+
+    EXPECT_EQ(ascii_prefix_length(""), 0);
+    EXPECT_EQ(ascii_prefix_length("abc"), 3);
+    EXPECT_EQ(ascii_prefix_length("abcdefghijklmnopq"), 17);
+    EXPECT_EQ(ascii_prefix_length("\xC3\xA4" "abcdefgh"), 0);
+
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::string text(20, 'A');
+        text[i] = '\x80';
+        EXPECT_EQ(ascii_prefix_length(text), i);
+        EXPECT_EQ(ascii_prefix_length(std::string_view(text).substr(1)), i ? i - 1 : text.size() - 1);
+    }
+}
+
 const std::string_view unicode_utf8 = (const char*)u8"\U00010000\U0000a123\U00000140\U00000041";
 [[maybe_unused]] const std::u32string_view unicode_utf32 = U"\U00010000\U0000a123\U00000140\U00000041";
 